@@ -5,72 +5,33 @@
 // ============================================================================
 
 #include <SFML/Graphics.hpp>
-#include <iostream>
 #include <filesystem>
 #include <memory>
 #include <vector>
 #include <fstream>
 #include <string>
-#include <random>
+#include <cstdint>
 #include <cmath>
 #include <algorithm>
 
 // ---- Project headers ----
-#include "Player.hpp"
-#include "Projectile.hpp"
-#include "Enemy.hpp"
+#include "Atlas.hpp"
+#include "GameSession.hpp"
+#include "Hud.hpp"
+#include "Input.hpp"
+#include "Log.hpp"
+#include "Particles.hpp"
+#include "ScoreJournal.hpp"
+#include "SimThread.hpp"   // GameState, RenderFrame, SimCommand
+#include "SpriteBatch.hpp"
+#include "World.hpp"
 #include "Db.hpp"   // << DB module
 
 // ============================================================================
-// ======================= Game state & constants =============================
+// ======================= Enemy (B): shared texture ==========================
 // ============================================================================
-enum class GameState { Menu, Arena, Results };
-
-static constexpr int   START_LIVES = 3;
-static constexpr float INVULN_TIME_SEC = 1.0f;   // after player is hit
-static constexpr float HURT_FLASH_TIME_SEC = 0.15f;  // white flash overlay
-static constexpr float PROJ_RADIUS = 3.0f;   // projectile hit circle
-// ============================================================================
-
-
-// ============================================================================
-// ======================= Enemy (B): state ===================================
-// ============================================================================
-std::vector<Enemy> g_enemies;
-
 // Optional shared texture for all enemies (keeps VRAM copies low)
 std::shared_ptr<sf::Texture> g_enemyTexture;
-
-// Spawn timing
-float g_enemySpawnAccumulator = 0.f;
-float g_enemySpawnEvery = 1.75f; // seconds
-// ============================================================================
-
-
-// ============================================================================
-// ==================== Enemy (D): helpers ====================================
-// ============================================================================
-static sf::Vector2f randomSpawnOnEdge(std::mt19937& rng, const sf::Vector2u winSize) {
-    std::uniform_int_distribution<int>    edgeDist(0, 3);
-    std::uniform_real_distribution<float> xDist(0.f, static_cast<float>(winSize.x));
-    std::uniform_real_distribution<float> yDist(0.f, static_cast<float>(winSize.y));
-
-    int edge = edgeDist(rng); // 0=top,1=right,2=bottom,3=left
-    switch (edge) {
-    case 0: return sf::Vector2f{ xDist(rng), -40.f };                         // top (offscreen)
-    case 1: return sf::Vector2f{ static_cast<float>(winSize.x) + 40.f, yDist(rng) }; // right
-    case 2: return sf::Vector2f{ xDist(rng), static_cast<float>(winSize.y) + 40.f }; // bottom
-    default:return sf::Vector2f{ -40.f, yDist(rng) };                          // left
-    }
-}
-
-static void spawnEnemy(std::vector<Enemy>& enemies,
-    const std::shared_ptr<sf::Texture>& enemyTex,
-    const sf::Vector2u winSize,
-    std::mt19937& rng) {
-    auto pos = randomSpawnOnEdge(rng, winSize);
-    enemies.emplace_back(enemyTex, pos, /*speed*/ 80.f, /*radius*/ 16.f);
-}
 // ============================================================================
 
 
@@ -96,11 +57,10 @@ static bool tryLoadBackground(const std::filesystem::path& rel,
     std::unique_ptr<sf::Texture>& bgTexture,
     std::unique_ptr<sf::Sprite>& background) {
     const auto abs = std::filesystem::absolute(rel);
-    std::cout << "Try: " << abs.string()
-        << "  exists? " << (std::filesystem::exists(abs) ? "YES" : "NO") << "\n";
+    AF_LOG_DEBUG("ASSET", "try %s  exists? %s", abs.string(), std::filesystem::exists(abs) ? "YES" : "NO");
     if (!std::filesystem::exists(abs)) return false;
     if (!loadTextureFromFileBytes(abs, bgTexture)) {
-        std::cout << "SFML failed to decode: " << abs.filename().string() << "\n";
+        AF_LOG_WARN("ASSET", "SFML failed to decode: %s", abs.filename().string());
         return false;
     }
     // Build sprite + scale to window
@@ -114,8 +74,7 @@ static bool tryLoadBackground(const std::filesystem::path& rel,
             static_cast<float>(win.y) / static_cast<float>(ts.y)
             });
     }
-    std::cout << "Loaded background: " << abs.filename().string()
-        << "  size: " << ts.x << "x" << ts.y << "\n";
+    AF_LOG_INFO("ASSET", "loaded background: %s  size: %ux%u", abs.filename().string(), ts.x, ts.y);
     return true;
 }
 
@@ -131,13 +90,23 @@ static bool robustLoadFont(sf::Font& font) {
     for (auto* p : candidates) {
         const auto abs = std::filesystem::absolute(p);
         if (font.openFromFile(abs.string())) {
-            std::cout << "[INFO] HUD font loaded: " << abs.string() << "\n";
+            AF_LOG_INFO("ASSET", "HUD font loaded: %s", abs.string());
             return true;
         }
     }
-    std::cout << "[WARN] No HUD font found in Assets/. HUD will be minimal.\n";
+    AF_LOG_WARN("ASSET", "no HUD font found in Assets/. HUD will be minimal.");
     return false;
 }
+
+// Camera centre that follows the player but never shows past the world edge
+static sf::Vector2f cameraCenterFor(sf::Vector2f target, const sf::Vector2u viewSize) {
+    const float hx = std::min(static_cast<float>(viewSize.x) / 2.f, world::WIDTH / 2.f);
+    const float hy = std::min(static_cast<float>(viewSize.y) / 2.f, world::HEIGHT / 2.f);
+    return sf::Vector2f{
+        std::clamp(target.x, hx, world::WIDTH - hx),
+        std::clamp(target.y, hy, world::HEIGHT - hy)
+    };
+}
 // ============================================================================
 
 
@@ -145,11 +114,14 @@ static bool robustLoadFont(sf::Font& font) {
 // ================================ main() ====================================
 // ============================================================================
 int main() {
+    // -------------------- Logging (async; drains to stdout) ------------------
+    logging::start();
+
     // -------------------- Window & basics -----------------------------------
     sf::RenderWindow window(sf::VideoMode{ sf::Vector2u{960u, 540u} }, "AlienForceClient");
     window.setFramerateLimit(120);
     // window.setVerticalSyncEnabled(true); // optional
-    std::cout << "CWD: " << std::filesystem::current_path().string() << "\n";
+    AF_LOG_INFO("APP", "CWD: %s", std::filesystem::current_path().string());
 
     // -------------------- Background loader ---------------------------------
     std::unique_ptr<sf::Texture> bgTexture;
@@ -165,7 +137,7 @@ int main() {
         bgOK = tryLoadBackground(name, window, bgTexture, background);
     }
     if (!bgOK) {
-        std::cout << "[ERROR] Could not load space_bg.(png|jpg|jpeg|bmp) from CWD or Assets.\n";
+        AF_LOG_ERROR("ASSET", "could not load space_bg.(png|jpg|jpeg|bmp) from CWD or Assets.");
     }
 
     // -------------------- Enemy (C): load texture ---------------------------
@@ -182,372 +154,245 @@ int main() {
         g_enemyTexture.reset(); // shape fallback
     }
 
-    // -------------------- Game objects --------------------------------------
-    Player player;
-    std::vector<Projectile> shots;
-    shots.reserve(128);
-
-    // -------------------- HUD (Score/Lives/State text) ----------------------
-    int score = 0;
-    int lives = START_LIVES;
-    float invulnTimer = 0.f;       // player invulnerability after being hit
-    float hurtFlashTimer = 0.f;    // brief white flash overlay
+    // -------------------- Sprite atlas (one texture bind for gameplay) -------
+    // Built by AlienForceAtlasPacker: CMake packs into the build tree (its path
+    // is compiled in), by hand it goes to Assets/atlas. Without either we fall
+    // back to the per-entity shapes / g_enemyTexture above.
+    Atlas       atlas;
+    GameSprites sprites;
+    SpriteBatch spriteBatch;
+    bool atlasOk = false;
+    std::filesystem::path atlasManifest = "Assets/atlas/atlas.txt";
+#ifdef ALIENFORCE_ATLAS_MANIFEST
+    if (std::filesystem::exists(ALIENFORCE_ATLAS_MANIFEST)) atlasManifest = ALIENFORCE_ATLAS_MANIFEST;
+#endif
+    if (auto err = atlas.loadFromFile(atlasManifest); !err.empty()) {
+        AF_LOG_WARN("ASSET", "no sprite atlas (%s); drawing shapes", err);
+    }
+    else if (auto rerr = sprites.resolve(atlas); !rerr.empty()) {
+        AF_LOG_WARN("ASSET", "sprite atlas unusable: %s", rerr);
+    }
+    else {
+        atlasOk = true;
+        AF_LOG_INFO("ASSET", "sprite atlas loaded: %zu page(s), enemy sprite %s",
+            atlas.pageCount(), sprites.hasEnemy ? "yes" : "no (disc)");
+    }
 
+    // -------------------- Game objects --------------------------------------
+    // The arena runs on its own fixed-rate thread; this thread only pumps
+    // events, forwards input and draws the newest published frame.
+    auto sim = std::make_unique<SimThread>(window.getSize(), g_enemyTexture);
+
+    // -------------------- Particles (hit / death effects, bounded cost) -----
+    // Kill/hit events from the sim become bursts; the budget caps both the
+    // live pool and what one frame may spawn, so a mass kill can't stall a frame.
+    ParticleSystem particles(ParticleBudget{ 8192, 2048 });
+    std::vector<ParticleBurst> bursts;
+    bursts.reserve(1024);
+
+    // -------------------- HUD (retained: lays out only on change) ----------
     sf::Font hudFont;
     const bool hudOk = robustLoadFont(hudFont);
-
-    std::unique_ptr<sf::Text> scoreText;
-    std::unique_ptr<sf::Text> livesText;
-    std::unique_ptr<sf::Text> infoText;
-
-    if (hudOk) {
-        scoreText = std::make_unique<sf::Text>(hudFont);
-        scoreText->setString("Score: 0");
-        scoreText->setCharacterSize(22);
-        scoreText->setFillColor(sf::Color::White);
-        scoreText->setOutlineColor(sf::Color(0, 0, 0));
-        scoreText->setOutlineThickness(2.f);
-        scoreText->setPosition(sf::Vector2f{ 12.f, 8.f });
-
-        livesText = std::make_unique<sf::Text>(hudFont);
-        livesText->setString("Lives: 3");
-        livesText->setCharacterSize(22);
-        livesText->setFillColor(sf::Color::White);
-        livesText->setOutlineColor(sf::Color(0, 0, 0));
-        livesText->setOutlineThickness(2.f);
-        livesText->setPosition(sf::Vector2f{ 12.f, 36.f });
-
-        infoText = std::make_unique<sf::Text>(hudFont);
-        infoText->setString("");
-        infoText->setCharacterSize(26);
-        infoText->setFillColor(sf::Color::White);
-        infoText->setOutlineColor(sf::Color(0, 0, 0));
-        infoText->setOutlineThickness(3.f);
-    }
+    Hud hud(hudOk ? &hudFont : nullptr);
 
     // -------------------- DB: connect once ----------------------------------
     if (auto err = db::connect_from_cfg("Assets/db.cfg"); !err.empty()) {
-        std::cout << "[DB] connect failed: " << err << "\n";
+        AF_LOG_WARN("DB", "connect failed: %s", err);
+    }
+    else {
+        AF_LOG_INFO("DB", "connected.");
+    }
+
+    // -------------------- Score journal (crash-safe path into the DB) -------
+    // Game-over scores are appended + fsynced here first; whatever a previous
+    // run couldn't store (crash, DB down) is replayed in bulk now.
+    ScoreJournal scoreJournal("scores.afsj",
+        [](const std::vector<ScoreSubmission>& rows) { return db::upsert_scores(rows); });
+    if (auto err = scoreJournal.open(); !err.empty()) {
+        AF_LOG_ERROR("DB", "score journal unavailable (%s); saving directly", err);
     }
     else {
-        std::cout << "[DB] connected.\n";
+        sim->setScoreJournal(&scoreJournal);
     }
 
     // -------------------- State & timing ------------------------------------
-    GameState state = GameState::Menu;   // With font present we show a Menu
     sf::Clock  clock;
-    float shootCooldown = 0.f;
-    static std::mt19937 rng{ std::random_device{}() };
-    bool paused = false;
-    static bool savedThisRun = false;
+    bool showChunkStats = false;
+    GameState shownState = GameState::Menu;   // last state the HUD was built for
+
+    // UI/draw CPU time per frame, averaged over FRAME_AVG frames (F3 / F4 compare)
+    constexpr int FRAME_AVG = 120;
+    sf::Clock frameCpu;
+    std::int64_t frameCpuSumUs = 0;
+    int frameCpuCount = 0;
+    std::uint64_t particlesDroppedSeen = 0;   // particles.dropped() at the last [PERF] line
+
+    // -------------------- Camera (world view) + screen view (HUD) ------------
+    sf::View camera;
 
     // -------------------- Helpers (inline lambdas) --------------------------
-    auto circleHit = [](sf::Vector2f a, float ra, sf::Vector2f b, float rb) {
-        float dx = a.x - b.x, dy = a.y - b.y;
-        float r = ra + rb;
-        return (dx * dx + dy * dy) <= (r * r);
+    // A full command queue means the sim thread is stalled; the command is lost,
+    // so say so (once per 120 drops: Input is sent every frame)
+    std::uint64_t droppedCommands = 0;
+    auto send = [&](const SimCommand& cmd) {
+        if (sim->post(cmd)) return;
+        if (droppedCommands++ % 120 == 0) {
+            AF_LOG_WARN("SIM", "command queue full, dropped command %d (%llu dropped so far)",
+                static_cast<int>(cmd.type), static_cast<unsigned long long>(droppedCommands));
+        }
+        };
+    auto post = [&](SimCommand::Type type) {
+        SimCommand cmd;
+        cmd.type = type;
+        send(cmd);
         };
 
-    auto resetRun = [&]() {
-        score = 0;
-        lives = START_LIVES;
-        invulnTimer = 0.f;
-        hurtFlashTimer = 0.f;
-        g_enemies.clear();
-        shots.clear();
-        g_enemySpawnAccumulator = 0.f;
-        savedThisRun = false; // allow saving at next game over
-        if (hudOk) {
-            scoreText->setString("Score: 0");
-            livesText->setString("Lives: " + std::to_string(lives));
-        }
+    auto stateName = [](GameState st) {
+        return st == GameState::Menu ? "menu" : st == GameState::Results ? "results" : "arena";
         };
 
+    sim->start();
+
     // -------------------- Main loop -----------------------------------------
     while (window.isOpen()) {
+        // Newest frame the sim thread has published (never blocks)
+        const RenderFrame& frame = sim->latest();
+        const GameState state = frame.state;
+
         // ======================= Event pump =================================
+        // State changes are requests: the sim thread applies them in order
         while (auto ev = window.pollEvent()) {
             if (ev->is<sf::Event::Closed>()) window.close();
-            if (ev->is<sf::Event::FocusLost>() && state == GameState::Arena) {
-                paused = true;
-            }
+            if (ev->is<sf::Event::FocusLost>()) post(SimCommand::Type::Pause);
 
 
             if (auto key = ev->getIf<sf::Event::KeyPressed>()) {
                 const auto k = key->code;
                 if (k == sf::Keyboard::Key::Escape) {
-                    if (state == GameState::Arena) paused = !paused;
+                    if (state == GameState::Arena) post(SimCommand::Type::TogglePause);
                     else if (state == GameState::Menu) window.close();
                 }
-                if (k == sf::Keyboard::Key::Enter) {
-                    if (state == GameState::Menu) { resetRun(); state = GameState::Arena; }
-                    else if (state == GameState::Results) { resetRun(); state = GameState::Arena; }
-                }
-                if (k == sf::Keyboard::Key::R && state == GameState::Arena) {
-                    resetRun();
-                }
+                if (k == sf::Keyboard::Key::Enter) post(SimCommand::Type::Start);
+                if (k == sf::Keyboard::Key::R) post(SimCommand::Type::Reset);
+                if (k == sf::Keyboard::Key::F3) showChunkStats = !showChunkStats;
+                if (k == sf::Keyboard::Key::F4) hud.setImmediateMode(!hud.immediateMode());
+                if (k == sf::Keyboard::Key::F5) post(SimCommand::Type::QuickSave);
+                if (k == sf::Keyboard::Key::F9) post(SimCommand::Type::QuickLoad);
             }
         }
 
         // ======================= Frame timing ===============================
         const float dt = clock.restart().asSeconds();
         const float dtc = std::clamp(dt, 0.f, 0.033f); // clamp to ~30fps step max
+        frameCpu.restart();
 
         // Debounce used by Menu fallback input
         static float menuInputCooldown = 0.f;
         if (menuInputCooldown > 0.f) menuInputCooldown -= dtc;
 
         const auto sz = window.getSize();
+        const sf::View screenView(sf::FloatRect{
+            sf::Vector2f{ 0.f, 0.f },
+            sf::Vector2f{ static_cast<float>(sz.x), static_cast<float>(sz.y) } });
+        window.setView(screenView);
+
+        // ======================= HUD state (marks dirty only on change) =====
+        if (state != shownState) {
+            // Entering Results: query the leaderboard once, not every frame
+            if (state == GameState::Results) hud.setResults(frame.sim.score, db::top_scores(5, "demo"));
+            shownState = state;
+            particles.clear();   // sparks never outlive the screen they belong to
+        }
+        hud.setWindowSize(sz);
+        hud.setScore(frame.sim.score);
+        hud.setLives(frame.sim.lives);
+        hud.setScreen(state == GameState::Menu ? HudScreen::Menu
+            : state == GameState::Results ? HudScreen::Results
+            : frame.paused ? HudScreen::Paused : HudScreen::None);
+        if (showChunkStats) hud.setChunkStats(frame.chunks);
+        hud.layout();
+
+        // ======================= Effects: sim events -> particles ===========
+        bursts.clear();
+        FxEvent fx;
+        while (sim->pollFx(fx)) {
+            bursts.push_back(fx.type == FxEvent::Type::PlayerHit
+                ? ParticleBurst{ fx.position, sf::Color(90, 200, 255), 48, 320.f, 0.8f, 6.f }
+                : ParticleBurst{ fx.position, sf::Color(255, 170, 70), 24, 220.f, 0.6f, 5.f });
+        }
+        particles.emit(bursts);
+        if (!frame.paused) particles.update(dtc);
 
-        // ======================= MENU STATE =================================
-        if (state == GameState::Menu) {
-            window.clear();
-
-            if (background) { window.draw(*background); }
-            else {
-                sf::VertexArray grad(sf::PrimitiveType::TriangleStrip, 4);
-                grad[0].position = { 0.f, 0.f };
-                grad[1].position = { static_cast<float>(sz.x), 0.f };
-                grad[2].position = { 0.f, static_cast<float>(sz.y) };
-                grad[3].position = { static_cast<float>(sz.x), static_cast<float>(sz.y) };
-                grad[0].color = sf::Color(10, 10, 40);
-                grad[1].color = sf::Color(10, 10, 40);
-                grad[2].color = sf::Color(30, 30, 100);
-                grad[3].color = sf::Color(30, 30, 100);
-                window.draw(grad);
-            }
+        window.clear();
 
-            if (hudOk) {
-                infoText->setString("ALIEN FORCE — DEMO\n\nEnter: Play   Esc: Quit\n\nWASD to move  •  Space/Click to shoot");
-                auto gb = infoText->getGlobalBounds();
-                infoText->setPosition(sf::Vector2f{
-                    (static_cast<float>(sz.x) - gb.size.x) / 2.f,
-                    (static_cast<float>(sz.y) - gb.size.y) / 2.f
-                    });
-                window.draw(*infoText);
-            }
+        // ---- Background (image or gradient fallback)
+        if (background) window.draw(*background);
+        else hud.drawGradient(window);
 
+        if (state == GameState::Menu) {
             // --- Fallback start (works even if KeyPressed is missed) ---
             if (menuInputCooldown <= 0.f &&
                 (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Enter) ||
                     sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) ||
                     sf::Mouse::isButtonPressed(sf::Mouse::Button::Left))) {
-                resetRun();
-                state = GameState::Arena;
-                paused = false;
+                post(SimCommand::Type::Start);
                 menuInputCooldown = 0.25f;
-                std::cout << "[INFO] Menu start via fallback input.\n";
+                AF_LOG_INFO("APP", "menu start via fallback input.");
             }
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape)) window.close();
-
-            window.display();
-            continue;
-        }
-
-        // ======================= RESULTS STATE ================================
-        if (state == GameState::Results) {
-            window.clear();
-            if (background) window.draw(*background); else {
-                sf::VertexArray grad(sf::PrimitiveType::TriangleStrip, 4);
-                grad[0].position = { 0.f, 0.f };
-                grad[1].position = { static_cast<float>(sz.x), 0.f };
-                grad[2].position = { 0.f, static_cast<float>(sz.y) };
-                grad[3].position = { static_cast<float>(sz.x), static_cast<float>(sz.y) };
-                grad[0].color = sf::Color(10, 10, 40);
-                grad[1].color = sf::Color(10, 10, 40);
-                grad[2].color = sf::Color(30, 30, 100);
-                grad[3].color = sf::Color(30, 30, 100);
-                window.draw(grad);
-            }
-            if (hudOk) {
-                // Optional: show Top 5
-                std::string board = "GAME OVER\n\nScore: " + std::to_string(score) + "\n\n";
-                auto rows = db::top_scores(5, "demo");
-                if (!rows.empty()) {
-                    board += "TOP 5\n";
-                    int r = 1;
-                    for (auto& row : rows) {
-                        board += std::to_string(r++) + ". " + row.name + "  " + std::to_string(row.score) + "  (" + row.when + ")\n";
-                    }
-                    board += "\n";
-                }
-                board += "Enter: Play Again   Esc: Close";
-                infoText->setString(board);
-                auto gb = infoText->getGlobalBounds();
-                infoText->setPosition(sf::Vector2f{
-                    (static_cast<float>(sz.x) - gb.size.x) / 2.f,
-                    (static_cast<float>(sz.y) - gb.size.y) / 2.f
-                    });
-                window.draw(*infoText);
-            }
-            window.display();
-            continue;
         }
-
-        // ======================= ARENA GAMEPLAY ================================
-        if (!paused) {
-            // --- Timers ---
-            shootCooldown -= dtc;
-            if (invulnTimer > 0.f)    invulnTimer -= dtc;
-            if (hurtFlashTimer > 0.f) hurtFlashTimer -= dtc;
-
-            // --- Player input + update ---
-            player.handleInput(dtc);
-            player.update(dtc, window);
-
-            // --- Fire control ---
-            const bool fireKey = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space);
-            const bool fireMouse = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
-            if (fireKey || fireMouse) {
-                if (shootCooldown <= 0.f) {
-                    bool reused = false;
-                    for (auto& p : shots) {
-                        if (!p.alive) { p.fire(player.getMuzzle(), player.getForward()); reused = true; break; }
-                    }
-                    if (!reused) {
-                        Projectile p; p.fire(player.getMuzzle(), player.getForward()); shots.push_back(p);
-                    }
-                    shootCooldown = 0.12f;
-                }
+        else if (state == GameState::Arena) {
+            // --- Input -> sim thread (mouse mapped through the camera) ---
+            camera.setSize(sf::Vector2f{ static_cast<float>(sz.x), static_cast<float>(sz.y) });
+            camera.setCenter(cameraCenterFor(frame.sim.player.getPosition(), sz));
+            window.setView(camera);
+            if (!frame.paused) {
+                SimCommand cmd;
+                cmd.type = SimCommand::Type::Input;
+                cmd.input = pollLocalInput(window);
+                cmd.viewSize = sz;
+                send(cmd);
             }
 
-            // --- Projectiles update + cull out-of-bounds ---
-            for (auto& p : shots) p.update(dtc);
-            const sf::FloatRect bounds{
-                sf::Vector2f{0.f, 0.f},
-                sf::Vector2f{ static_cast<float>(sz.x), static_cast<float>(sz.y) }
-            };
-            for (auto& p : shots) if (p.outOf(bounds)) p.alive = false;
-
-            // --- Enemies: spawn + update toward player ---
-            const sf::Vector2f playerPosForAI = player.getMuzzle();
-            g_enemySpawnAccumulator += dtc;
-            if (g_enemySpawnAccumulator >= g_enemySpawnEvery) {
-                g_enemySpawnAccumulator = 0.f;
-                spawnEnemy(g_enemies, g_enemyTexture, window.getSize(), rng);
-            }
-            for (auto& e : g_enemies) {
-                e.update(dtc, playerPosForAI);
-            }
-
-            // --- Collision: projectiles vs enemies ---
-            for (auto& e : g_enemies) {
-                if (!e.isAlive()) continue;
-                for (auto& p : shots) {
-                    if (!p.alive) continue;
-                    const sf::Vector2f projPos = p.getPosition();
-                    if (circleHit(projPos, PROJ_RADIUS, e.position(), e.radius())) {
-                        p.alive = false;
-                        e.kill();
-                        score += 10;
-                        if (hudOk) scoreText->setString("Score: " + std::to_string(score));
-                        break;
-                    }
-                }
-            }
+            // ---- World: chunk grid, player, projectiles & enemies (camera follows player)
+            drawChunkGrid(window, camera);
+            if (atlasOk) drawSimState(window, frame.sim, sprites, spriteBatch);
+            else drawSimState(window, frame.sim, g_enemyTexture.get());
+            particles.draw(window, atlasOk ? &sprites : nullptr);   // one draw call
+            window.setView(screenView);
+        }
 
-            // --- Collision: enemies vs player (approx via muzzle position) ---
-            constexpr float PLAYER_RADIUS = 18.f;
-            if (invulnTimer <= 0.f) {
-                for (auto& e : g_enemies) {
-                    if (!e.isAlive()) continue;
-                    const float dx = playerPosForAI.x - e.position().x;
-                    const float dy = playerPosForAI.y - e.position().y;
-                    const float R = PLAYER_RADIUS + e.radius();
-                    if (dx * dx + dy * dy <= R * R) {
-                        lives -= 1;
-                        if (hudOk) livesText->setString("Lives: " + std::to_string(lives));
-                        invulnTimer = INVULN_TIME_SEC;
-                        hurtFlashTimer = HURT_FLASH_TIME_SEC;
-                        e.kill();
-                        break;
-                    }
+        // ===================== HUD: score/lives, panel, debug, hurt flash ======
+        hud.draw(window, state == GameState::Arena, showChunkStats,
+            state == GameState::Arena && frame.sim.hurtFlashTimer > 0.f);
+
+        // ---- Frame CPU time (excludes display(), i.e. the vsync/limit wait)
+        frameCpuSumUs += frameCpu.getElapsedTime().asMicroseconds();
+        if (++frameCpuCount == FRAME_AVG) {
+            const float avgUs = static_cast<float>(frameCpuSumUs) / FRAME_AVG;
+            if (showChunkStats) {
+                hud.setFrameTimeUs(avgUs);
+                if (state != GameState::Arena) {
+                    AF_LOG_INFO("PERF", "%s frame cpu %.1f us (%s HUD)", stateName(state), avgUs,
+                        hud.immediateMode() ? "immediate" : "retained");
                 }
-            }
-
-            // --- GC: remove dead/expired entities ---
-            g_enemies.erase(
-                std::remove_if(g_enemies.begin(), g_enemies.end(),
-                    [](const Enemy& e) { return !e.isAlive(); }),
-                g_enemies.end()
-            );
-            shots.erase(
-                std::remove_if(shots.begin(), shots.end(),
-                    [](const Projectile& p) { return !p.alive; }),
-                shots.end()
-            );
-
-            // --- Check game over ---
-            if (lives <= 0) {
-                state = GameState::Results;
-
-                // DB: save score exactly once per run
-                if (!savedThisRun) {
-                    if (auto err = db::upsert_player_and_add_score("TestPilot", score); !err.empty()) {
-                        std::cout << "[DB] save failed: " << err << "\n";
-                    }
-                    else {
-                        std::cout << "[DB] score saved.\n";
-                    }
-                    savedThisRun = true;
+                else {
+                    const std::uint64_t dropped = particles.dropped();
+                    AF_LOG_INFO("PERF", "arena frame cpu %.1f us, %zu particles (%llu over budget, %llu total)", avgUs,
+                        particles.size(), static_cast<unsigned long long>(dropped - particlesDroppedSeen),
+                        static_cast<unsigned long long>(dropped));
+                    particlesDroppedSeen = dropped;
                 }
             }
-        }
-
-        // ========================= Render ===================================
-        window.clear();
-
-        // ---- Background (image or gradient fallback)
-        if (background) {
-            window.draw(*background);
-        }
-        else {
-            sf::VertexArray grad(sf::PrimitiveType::TriangleStrip, 4);
-            grad[0].position = { 0.f, 0.f };
-            grad[1].position = { static_cast<float>(sz.x), 0.f };
-            grad[2].position = { 0.f, static_cast<float>(sz.y) };
-            grad[3].position = { static_cast<float>(sz.x), static_cast<float>(sz.y) };
-            grad[0].color = sf::Color(10, 10, 40);
-            grad[1].color = sf::Color(10, 10, 40);
-            grad[2].color = sf::Color(30, 30, 100);
-            grad[3].color = sf::Color(30, 30, 100);
-            window.draw(grad);
-        }
-
-        // ---- Player & projectiles
-        player.draw(window);
-        for (auto& p : shots) p.draw(window);
-
-        // ===================== Enemy (F): draw ===============================
-        for (const auto& e : g_enemies) {
-            e.draw(window);
-        }
-
-        // ===================== HUD: score/lives/pause ========================
-        if (hudOk) {
-            window.draw(*scoreText);
-            window.draw(*livesText);
-
-            if (paused) {
-                infoText->setString("PAUSED\n\nEsc: Resume   R: Reset");
-                auto gb = infoText->getGlobalBounds();
-                infoText->setPosition(sf::Vector2f{
-                    (static_cast<float>(sz.x) - gb.size.x) / 2.f,
-                    (static_cast<float>(sz.y) - gb.size.y) / 2.f
-                    });
-                window.draw(*infoText);
-            }
-        }
-
-        // ===================== Hurt flash overlay ============================
-        if (hurtFlashTimer > 0.f) {
-            sf::RectangleShape flash(sf::Vector2f{ static_cast<float>(sz.x), static_cast<float>(sz.y) });
-            flash.setFillColor(sf::Color(255, 255, 255, 120));
-            window.draw(flash);
+            frameCpuSumUs = 0;
+            frameCpuCount = 0;
         }
 
         window.display();
     }
 
+    sim->stop();
+    scoreJournal.stop();   // commits the last score before the logger goes away
+    logging::stop();
     return 0;
 }
@@ -0,0 +1,59 @@
+#include "Atlas.hpp"
+#include <fstream>
+#include <sstream>
+
+std::string Atlas::loadFromFile(const std::filesystem::path& manifest) {
+    std::ifstream in(manifest);
+    if (!in) return "cannot open " + manifest.string();
+
+    std::vector<std::unique_ptr<sf::Texture>>    pages;
+    std::unordered_map<std::string, AtlasRegion> regions;
+    const std::filesystem::path dir = manifest.parent_path();
+
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        ++lineNo;
+        if (line.empty() || line[0] == '#' || line[0] == '\r') continue;
+
+        std::istringstream ls(line);
+        std::string kind;
+        ls >> kind;
+        if (kind == "page") {
+            std::size_t index = 0;
+            std::string file;
+            unsigned w = 0, h = 0;
+            if (!(ls >> index >> file >> w >> h) || index != pages.size()) {
+                return "bad page entry on line " + std::to_string(lineNo);
+            }
+            auto tex = std::make_unique<sf::Texture>();
+            if (!tex->loadFromFile(dir / file)) return "cannot load atlas page " + (dir / file).string();
+            pages.push_back(std::move(tex));
+        }
+        else if (kind == "region") {
+            std::string name;
+            AtlasRegion r;
+            if (!(ls >> name >> r.page >> r.rect.position.x >> r.rect.position.y >> r.rect.size.x >> r.rect.size.y)) {
+                return "bad region entry on line " + std::to_string(lineNo);
+            }
+            regions[name] = r;
+        }
+        else {
+            return "unknown entry '" + kind + "' on line " + std::to_string(lineNo);
+        }
+    }
+
+    for (const auto& [name, r] : regions) {
+        if (r.page >= pages.size()) return "region " + name + " refers to a missing page";
+    }
+    if (pages.empty()) return "atlas has no pages";
+
+    m_pages = std::move(pages);
+    m_regions = std::move(regions);
+    return {};
+}
+
+const AtlasRegion* Atlas::find(std::string_view name) const {
+    auto it = m_regions.find(std::string(name));
+    return it == m_regions.end() ? nullptr : &it->second;
+}
@@ -0,0 +1,220 @@
+// ============================================================================
+//  AtlasPacker.cpp — packs sprite images into atlas pages + a UV manifest
+//  Usage: AlienForceAtlasPacker [--in Assets] [--out Assets/atlas]
+//                               [--page-size 2048] [--padding 2]
+//                               [--exclude space_bg]
+//  Scans --in recursively for .png/.bmp/.tga/.jpg (skipping --out and any
+//  file whose name contains --exclude, e.g. full-screen backgrounds), adds
+//  the built-in "white" and "disc" regions, shelf-packs everything tallest
+//  first and writes atlas_<n>.png pages plus atlas.txt (format in Atlas.hpp).
+//  Each region's border pixels are extruded into its padding so filtering
+//  never bleeds a neighbour in.
+// ============================================================================
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "BenchUtil.hpp"
+
+namespace fs = std::filesystem;
+
+struct PackerOptions {
+    fs::path    in = "Assets";
+    fs::path    out = "Assets/atlas";
+    unsigned    pageSize = 2048;
+    unsigned    padding = 2;
+    std::string exclude = "space_bg";
+};
+
+static PackerOptions parseArgs(int argc, char** argv) {
+    PackerOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--in")             o.in = v;
+        else if (k == "--out")       o.out = v;
+        else if (k == "--page-size") o.pageSize = static_cast<unsigned>(std::max(64, std::atoi(v)));
+        else if (k == "--padding")   o.padding = static_cast<unsigned>(std::max(0, std::atoi(v)));
+        else if (k == "--exclude")   o.exclude = v;
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+struct Sprite {
+    std::string name;       // path under --in, no extension, '/' separated
+    sf::Image   image;
+    unsigned    page = 0;
+    sf::Vector2u pos{ 0u, 0u };
+};
+
+// ---- Built-in regions -------------------------------------------------------
+static sf::Image makeWhite() {
+    return sf::Image(sf::Vector2u{ 8u, 8u }, sf::Color::White);
+}
+
+// White disc with a one-pixel anti-aliased edge (alpha = coverage)
+static sf::Image makeDisc(unsigned size) {
+    sf::Image img(sf::Vector2u{ size, size }, sf::Color::Transparent);
+    const float r = size * 0.5f;
+    for (unsigned y = 0; y < size; ++y) {
+        for (unsigned x = 0; x < size; ++x) {
+            const float dx = x + 0.5f - r;
+            const float dy = y + 0.5f - r;
+            const float coverage = std::clamp(r - std::sqrt(dx * dx + dy * dy), 0.f, 1.f);
+            img.setPixel(sf::Vector2u{ x, y }, sf::Color(255, 255, 255, static_cast<std::uint8_t>(coverage * 255.f)));
+        }
+    }
+    return img;
+}
+
+static bool isImageFile(const fs::path& p) {
+    std::string ext = p.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext == ".png" || ext == ".bmp" || ext == ".tga" || ext == ".jpg" || ext == ".jpeg";
+}
+
+// Copy `src` into `page` at `pos` and smear its edge pixels `pad` pixels outward
+static void blitExtruded(sf::Image& page, const sf::Image& src, sf::Vector2u pos, unsigned pad) {
+    const sf::Vector2u size = src.getSize();
+    const int w = static_cast<int>(size.x), h = static_cast<int>(size.y), p = static_cast<int>(pad);
+    for (int y = -p; y < h + p; ++y) {
+        for (int x = -p; x < w + p; ++x) {
+            const unsigned sx = static_cast<unsigned>(std::clamp(x, 0, w - 1));
+            const unsigned sy = static_cast<unsigned>(std::clamp(y, 0, h - 1));
+            page.setPixel(sf::Vector2u{ static_cast<unsigned>(static_cast<int>(pos.x) + x),
+                                        static_cast<unsigned>(static_cast<int>(pos.y) + y) },
+                src.getPixel(sf::Vector2u{ sx, sy }));
+        }
+    }
+}
+
+// Regions GameSprites::resolve() needs on one page (the gameplay batch binds one texture)
+static bool isGameplayRegion(const std::string& name) {
+    return name == "white" || name == "disc" || name == "enemy" || name == "textures/enemy";
+}
+
+static unsigned nextPow2(unsigned v) {
+    unsigned p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+int main(int argc, char** argv) {
+    const PackerOptions opt = parseArgs(argc, argv);
+
+    // ---- Collect sprites ----
+    std::vector<Sprite> sprites;
+    sprites.push_back(Sprite{ "white", makeWhite() });
+    sprites.push_back(Sprite{ "disc", makeDisc(64) });
+
+    std::error_code ec;
+    const fs::path outAbs = fs::weakly_canonical(opt.out, ec);
+    if (fs::is_directory(opt.in)) {
+        for (auto it = fs::recursive_directory_iterator(opt.in); it != fs::recursive_directory_iterator(); ++it) {
+            if (it->is_directory() && fs::weakly_canonical(it->path(), ec) == outAbs) {
+                it.disable_recursion_pending();   // never pack our own output
+                continue;
+            }
+            if (!it->is_regular_file() || !isImageFile(it->path())) continue;
+            if (!opt.exclude.empty() && it->path().filename().string().find(opt.exclude) != std::string::npos) continue;
+
+            Sprite s;
+            s.name = fs::relative(it->path(), opt.in).replace_extension().generic_string();
+            if (s.name.find_first_of(" \t") != std::string::npos) {
+                std::cout << "[WARN] skipping " << s.name << ": region names can't contain spaces\n";
+                continue;
+            }
+            if (!s.image.loadFromFile(it->path())) {
+                std::cout << "[WARN] skipping unreadable image " << it->path().string() << "\n";
+                continue;
+            }
+            const sf::Vector2u sz = s.image.getSize();
+            if (sz.x + 2 * opt.padding > opt.pageSize || sz.y + 2 * opt.padding > opt.pageSize) {
+                std::cout << "[WARN] " << s.name << " (" << sz.x << "x" << sz.y << ") is larger than a page, skipped\n";
+                continue;
+            }
+            sprites.push_back(std::move(s));
+        }
+    }
+    else {
+        std::cout << "[WARN] input folder " << opt.in.string() << " not found; packing built-ins only\n";
+    }
+
+    // ---- Shelf packing: gameplay regions first so they share page 0, then
+    //      everything else tallest first (stable: ties keep name order) ----
+    std::sort(sprites.begin(), sprites.end(), [](const Sprite& a, const Sprite& b) { return a.name < b.name; });
+    std::stable_sort(sprites.begin(), sprites.end(),
+        [](const Sprite& a, const Sprite& b) { return a.image.getSize().y > b.image.getSize().y; });
+    std::stable_partition(sprites.begin(), sprites.end(), [](const Sprite& s) { return isGameplayRegion(s.name); });
+
+    struct PageFill { unsigned shelfY = 0, shelfH = 0, cursorX = 0, usedW = 0; };
+    std::vector<PageFill> pages(1);
+    for (auto& s : sprites) {
+        const sf::Vector2u cell = s.image.getSize() + sf::Vector2u{ 2 * opt.padding, 2 * opt.padding };
+        PageFill* pf = &pages.back();
+        if (pf->cursorX + cell.x > opt.pageSize) {           // next shelf
+            pf->shelfY += pf->shelfH;
+            pf->shelfH = 0;
+            pf->cursorX = 0;
+        }
+        if (pf->shelfY + cell.y > opt.pageSize) {            // next page
+            pages.emplace_back();
+            pf = &pages.back();
+        }
+        s.page = static_cast<unsigned>(pages.size() - 1);
+        s.pos = sf::Vector2u{ pf->cursorX + opt.padding, pf->shelfY + opt.padding };
+        pf->cursorX += cell.x;
+        pf->usedW = std::max(pf->usedW, pf->cursorX);
+        pf->shelfH = std::max(pf->shelfH, cell.y);
+    }
+    for (const auto& s : sprites) {
+        if (isGameplayRegion(s.name) && s.page != 0) {
+            std::cout << "[WARN] gameplay region " << s.name << " didn't fit on page 0; the client will draw shapes (raise --page-size)\n";
+        }
+    }
+
+    // ---- Write pages + manifest ----
+    fs::create_directories(opt.out, ec);
+    std::ofstream manifest(opt.out / "atlas.txt", std::ios::trunc);
+    if (!manifest) {
+        std::cout << "[ERROR] cannot write " << (opt.out / "atlas.txt").string() << "\n";
+        return 1;
+    }
+    manifest << "# AlienForce atlas manifest (generated by AlienForceAtlasPacker)\n";
+
+    for (unsigned p = 0; p < pages.size(); ++p) {
+        // Trim each page to the used area (power of two keeps old GPUs happy)
+        const unsigned usedH = pages[p].shelfY + pages[p].shelfH;
+        const sf::Vector2u pageSize{ std::min(opt.pageSize, nextPow2(std::max(pages[p].usedW, 1u))),
+                                     std::min(opt.pageSize, nextPow2(std::max(usedH, 1u))) };
+        sf::Image page(pageSize, sf::Color::Transparent);
+        for (const auto& s : sprites) {
+            if (s.page == p) blitExtruded(page, s.image, s.pos, opt.padding);
+        }
+        const std::string file = "atlas_" + std::to_string(p) + ".png";
+        if (!page.saveToFile(opt.out / file)) {
+            std::cout << "[ERROR] cannot write " << (opt.out / file).string() << "\n";
+            return 1;
+        }
+        manifest << "page " << p << " " << file << " " << pageSize.x << " " << pageSize.y << "\n";
+    }
+    for (const auto& s : sprites) {
+        const sf::Vector2u sz = s.image.getSize();
+        manifest << "region " << s.name << " " << s.page << " " << s.pos.x << " " << s.pos.y
+            << " " << sz.x << " " << sz.y << "\n";
+    }
+
+    std::cout << "[ATLAS] " << sprites.size() << " regions on " << pages.size() << " page(s) -> "
+        << (opt.out / "atlas.txt").string() << "\n";
+    return 0;
+}
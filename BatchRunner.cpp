@@ -0,0 +1,238 @@
+// ============================================================================
+//  BatchRunner.cpp — N seeded, Bot-driven headless runs spread over all cores
+//  Usage: AlienForceBatchRunner [--runs N] [--threads T] [--seed X] [--hz H]
+//                               [--max-seconds S] [--spawn-every S]
+//                               [--enemy-speed V] [--out report.csv]
+//                               [--per-run runs.csv] [--score-bucket W]
+//                               [--survival-bucket S]
+//  Every run goes from reset(seed) to game over (or the time cap) as fast as
+//  the CPU allows. Score, survival time and tick cost are aggregated into
+//  histograms and written as one CSV report. Bucket widths are fixed (not
+//  derived from the batch), so reports of two batches line up row for row.
+// ============================================================================
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Bot.hpp"
+#include "GameSession.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct BatchOptions {
+    int           runs = 1000;
+    int           threads = 0;              // 0 = hardware_concurrency
+    std::uint32_t seed = 1;
+    int           hz = 120;
+    float         maxSeconds = 180.f;       // cap for runs the bot never loses
+    // Harder than the game's defaults (1.75 s, 80 px/s), which the bot
+    // survives every time: here runs end between ~5 s and the cap
+    float         spawnEvery = 0.12f;
+    float         enemySpeed = 180.f;
+    double        scoreBucket = 500.0;      // histogram widths
+    double        survivalBucket = 10.0;    // seconds
+    std::string   out = "batch_report.csv";
+    std::string   perRun;                   // optional per-run CSV
+};
+
+static BatchOptions parseArgs(int argc, char** argv) {
+    BatchOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--runs")             o.runs = std::max(1, std::atoi(v));
+        else if (k == "--threads")     o.threads = std::max(0, std::atoi(v));
+        else if (k == "--seed")        o.seed = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        else if (k == "--hz")          o.hz = std::max(1, std::atoi(v));
+        else if (k == "--max-seconds") o.maxSeconds = static_cast<float>(std::atof(v));
+        else if (k == "--spawn-every") o.spawnEvery = static_cast<float>(std::atof(v));
+        else if (k == "--enemy-speed") o.enemySpeed = static_cast<float>(std::atof(v));
+        else if (k == "--out")         o.out = v;
+        else if (k == "--per-run")     o.perRun = v;
+        else if (k == "--score-bucket")    o.scoreBucket = std::max(1.0, std::atof(v));
+        else if (k == "--survival-bucket") o.survivalBucket = std::max(0.1, std::atof(v));
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+// Tick cost histogram: bucket b holds steps that took [2^b, 2^(b+1)) ns
+static constexpr int TICK_BUCKETS = 32;
+using TickHistogram = std::array<std::uint64_t, TICK_BUCKETS>;
+
+static int tickBucket(std::int64_t ns) {
+    int b = 0;
+    while (ns > 1 && b < TICK_BUCKETS - 1) { ns >>= 1; ++b; }
+    return b;
+}
+
+// Upper bound (ns) of the bucket containing percentile p
+static std::uint64_t histogramPercentileNs(const TickHistogram& h, double p) {
+    std::uint64_t total = 0;
+    for (auto c : h) total += c;
+    if (total == 0) return 0;
+    const std::uint64_t target = static_cast<std::uint64_t>(std::ceil(p * static_cast<double>(total)));
+    std::uint64_t seen = 0;
+    for (int b = 0; b < TICK_BUCKETS; ++b) {
+        seen += h[b];
+        if (seen >= target) return std::uint64_t{ 1 } << (b + 1);
+    }
+    return std::uint64_t{ 1 } << TICK_BUCKETS;
+}
+
+struct RunResult {
+    std::uint64_t seed = 0;
+    int           score = 0;
+    float         survival = 0.f;   // arena seconds
+    std::uint64_t ticks = 0;
+    std::int64_t  maxTickNs = 0;
+    bool          timedOut = false;
+};
+
+// Linear histogram with a fixed bucket width: bucket b holds [b*width, (b+1)*width),
+// grown as far as the largest value needs
+struct LinearHistogram {
+    double                     width = 1.0;
+    std::vector<std::uint64_t> counts;
+
+    explicit LinearHistogram(double bucketWidth) : width(bucketWidth) {}
+
+    void add(double v) {
+        const std::size_t b = static_cast<std::size_t>(std::max(0.0, v) / width);
+        if (b >= counts.size()) counts.resize(b + 1, 0);
+        ++counts[b];
+    }
+};
+
+int main(int argc, char** argv) {
+    const BatchOptions opt = parseArgs(argc, argv);
+    const float dt = 1.f / static_cast<float>(opt.hz);
+    const std::uint64_t maxTicks = static_cast<std::uint64_t>(std::max(1.f, opt.maxSeconds * opt.hz));
+    const int threadCount = std::max(1, std::min(opt.runs,
+        opt.threads > 0 ? opt.threads : static_cast<int>(std::thread::hardware_concurrency())));
+
+    std::cout << "[BATCH] " << opt.runs << " runs on " << threadCount << " threads @ " << opt.hz
+        << " Hz  (spawn every " << opt.spawnEvery << " s, enemy speed " << opt.enemySpeed
+        << ", cap " << opt.maxSeconds << " s)\n";
+
+    // Each run writes only its own slot; workers pull run indices from a shared counter
+    std::vector<RunResult>     results(opt.runs);
+    std::vector<TickHistogram> tickHists(threadCount, TickHistogram{});
+    std::atomic<int>           nextRun{ 0 };
+
+    auto worker = [&](int w) {
+        // One session + bot per thread, reseeded per run (no per-run allocation)
+        GameSession session(sf::Vector2u{ 960u, 540u }, nullptr, opt.seed);
+        session.setSpawnInterval(opt.spawnEvery);
+        session.setEnemySpeed(opt.enemySpeed);
+        TickHistogram& hist = tickHists[w];
+
+        for (int i = nextRun.fetch_add(1); i < opt.runs; i = nextRun.fetch_add(1)) {
+            RunResult& r = results[i];
+            r.seed = static_cast<std::uint64_t>(opt.seed) + static_cast<std::uint64_t>(i);
+            session.reset(r.seed);
+            Bot bot(opt.seed * 7919u + static_cast<std::uint32_t>(i));
+
+            while (!session.isGameOver() && session.tick() < maxTicks) {
+                const auto t0 = Clock::now();
+                session.step(dt, bot.think(session, dt));
+                const std::int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+                ++hist[tickBucket(ns)];
+                r.maxTickNs = std::max(r.maxTickNs, ns);
+            }
+
+            r.score = session.score();
+            r.survival = session.elapsed();
+            r.ticks = session.tick();
+            r.timedOut = !session.isGameOver();
+        }
+        };
+
+    const auto wallStart = Clock::now();
+    std::vector<std::thread> pool;
+    pool.reserve(threadCount);
+    for (int w = 0; w < threadCount; ++w) pool.emplace_back(worker, w);
+    for (auto& t : pool) t.join();
+    const double wallSec = std::chrono::duration<double>(Clock::now() - wallStart).count();
+
+    // ---- Aggregate ----
+    TickHistogram tickHist{};
+    for (const auto& h : tickHists) {
+        for (int b = 0; b < TICK_BUCKETS; ++b) tickHist[b] += h[b];
+    }
+
+    int maxScore = 0;
+    float maxSurvival = 0.f;
+    double scoreSum = 0.0, survivalSum = 0.0;
+    int timedOut = 0;
+    for (const auto& r : results) {
+        maxScore = std::max(maxScore, r.score);
+        maxSurvival = std::max(maxSurvival, r.survival);
+        scoreSum += r.score;
+        survivalSum += r.survival;
+        timedOut += r.timedOut ? 1 : 0;
+    }
+
+    LinearHistogram scoreHist(opt.scoreBucket);
+    LinearHistogram survivalHist(opt.survivalBucket);
+    for (const auto& r : results) {
+        scoreHist.add(r.score);
+        survivalHist.add(r.survival);
+    }
+
+    std::vector<int> scores;
+    scores.reserve(results.size());
+    for (const auto& r : results) scores.push_back(r.score);
+    std::sort(scores.begin(), scores.end());
+    auto scoreAt = [&](double p) { return scores[std::min(scores.size() - 1, static_cast<std::size_t>(p * (scores.size() - 1)))]; };
+
+    std::cout << "[BATCH] wall " << wallSec << " s, " << opt.runs / wallSec * 60.0 << " runs/min, "
+        << survivalSum / wallSec << "x realtime (all threads)\n";
+    std::cout << "[BATCH] score  mean " << scoreSum / opt.runs << "  p10 " << scoreAt(0.10)
+        << "  p50 " << scoreAt(0.50) << "  p90 " << scoreAt(0.90) << "  max " << maxScore << "\n";
+    std::cout << "[BATCH] survival mean " << survivalSum / opt.runs << " s  max " << maxSurvival
+        << " s  (" << timedOut << " runs hit the cap)\n";
+    std::cout << "[BATCH] tick ns  p50 <" << histogramPercentileNs(tickHist, 0.50)
+        << "  p99 <" << histogramPercentileNs(tickHist, 0.99)
+        << "  p99.9 <" << histogramPercentileNs(tickHist, 0.999) << "\n";
+
+    // ---- CSV report: one row per histogram bucket ----
+    std::ofstream csv(opt.out, std::ios::trunc);
+    if (!csv) {
+        std::cout << "[WARN] could not write " << opt.out << "\n";
+        return 1;
+    }
+    csv << "histogram,bucket_lo,bucket_hi,count\n";
+    for (std::size_t b = 0; b < scoreHist.counts.size(); ++b) {
+        csv << "score," << b * scoreHist.width << "," << (b + 1) * scoreHist.width << "," << scoreHist.counts[b] << "\n";
+    }
+    for (std::size_t b = 0; b < survivalHist.counts.size(); ++b) {
+        csv << "survival_s," << b * survivalHist.width << "," << (b + 1) * survivalHist.width << "," << survivalHist.counts[b] << "\n";
+    }
+    for (int b = 0; b < TICK_BUCKETS; ++b) {
+        if (tickHist[b] == 0) continue;
+        csv << "tick_ns," << (std::uint64_t{ 1 } << b) << "," << (std::uint64_t{ 1 } << (b + 1)) << "," << tickHist[b] << "\n";
+    }
+    std::cout << "[BATCH] report -> " << opt.out << "\n";
+
+    if (!opt.perRun.empty()) {
+        std::ofstream runs(opt.perRun, std::ios::trunc);
+        runs << "seed,score,survival_s,ticks,max_tick_ns,timed_out\n";
+        for (const auto& r : results) {
+            runs << r.seed << "," << r.score << "," << r.survival << "," << r.ticks << ","
+                << r.maxTickNs << "," << (r.timedOut ? 1 : 0) << "\n";
+        }
+        std::cout << "[BATCH] per-run -> " << opt.perRun << "\n";
+    }
+    return 0;
+}
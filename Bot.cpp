@@ -0,0 +1,72 @@
+#include "Bot.hpp"
+#include "GameSession.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static constexpr float FIRE_RANGE = 420.f;   // start shooting inside this
+static constexpr float DANGER_RANGE = 140.f;   // kite away inside this
+static constexpr float EDGE_MARGIN = 60.f;    // keep this far from the world edge
+static constexpr float WANDER_RANGE = 600.f;   // max wander step from the current spot
+static constexpr float AIM_JITTER = 10.f;    // px of aim error
+
+Bot::Bot(std::uint32_t seed) {
+    m_rng.seed(seed);
+}
+
+PlayerInput Bot::think(const GameSession& session, float dt) {
+    PlayerInput in;
+    const sf::Vector2f me = session.player().getPosition();
+
+    // --- Nearest live enemy ---
+    const Enemy* nearest = nullptr;
+    float bestD2 = std::numeric_limits<float>::max();
+    for (const auto& e : session.enemies()) {
+        if (!e.isAlive()) continue;
+        const sf::Vector2f d = e.position() - me;
+        const float d2 = d.x * d.x + d.y * d.y;
+        if (d2 < bestD2) { bestD2 = d2; nearest = &e; }
+    }
+
+    // --- Wander target near the current spot (re-rolled every couple of seconds) ---
+    m_wanderTimer -= dt;
+    if (m_wanderTimer <= 0.f) {
+        const float offX = m_rng.uniform(-WANDER_RANGE, WANDER_RANGE);
+        const float offY = m_rng.uniform(-WANDER_RANGE, WANDER_RANGE);
+        m_wanderTarget = sf::Vector2f{
+            std::clamp(me.x + offX, EDGE_MARGIN, world::WIDTH - EDGE_MARGIN),
+            std::clamp(me.y + offY, EDGE_MARGIN, world::HEIGHT - EDGE_MARGIN)
+        };
+        m_wanderTimer = m_rng.uniform(1.f, 3.f);
+        m_strafeSign = (m_rng.next() & 1u) ? 1.f : -1.f;
+    }
+
+    sf::Vector2f move = m_wanderTarget - me;
+
+    if (nearest) {
+        const float jx = m_rng.uniform(-AIM_JITTER, AIM_JITTER);
+        const float jy = m_rng.uniform(-AIM_JITTER, AIM_JITTER);
+        in.aim = nearest->position() + sf::Vector2f{ jx, jy };
+        in.fire = bestD2 <= FIRE_RANGE * FIRE_RANGE;
+
+        if (bestD2 <= DANGER_RANGE * DANGER_RANGE) {
+            // Back off and circle so the enemy doesn't catch up head-on
+            const sf::Vector2f away = me - nearest->position();
+            const sf::Vector2f side{ -away.y * m_strafeSign, away.x * m_strafeSign };
+            move = away + side * 0.6f;
+        }
+    }
+    else {
+        in.aim = me + sf::Vector2f{ 0.f, -1.f };
+    }
+
+    // --- Stay inside the world ---
+    if (me.x < EDGE_MARGIN)                    move.x = std::abs(move.x) + 1.f;
+    if (me.x > world::WIDTH - EDGE_MARGIN)     move.x = -std::abs(move.x) - 1.f;
+    if (me.y < EDGE_MARGIN)                    move.y = std::abs(move.y) + 1.f;
+    if (me.y > world::HEIGHT - EDGE_MARGIN)    move.y = -std::abs(move.y) - 1.f;
+
+    // Player normalizes the vector; just drop tiny moves to avoid jitter
+    if (move.x * move.x + move.y * move.y > 4.f) in.move = move;
+    return in;
+}
@@ -30,6 +30,18 @@ namespace db {
         return upsert_player_and_add_score(player_name, score, "demo");
     }
 
+    // Bulk version – one round trip once a real backend exists; for now
+    // forwards row by row to the no-op above
+    std::string upsert_scores(const std::vector<ScoreSubmission>& rows)
+    {
+        for (const ScoreSubmission& r : rows) {
+            if (auto err = upsert_player_and_add_score(r.player, r.score, r.mode); !err.empty()) {
+                return err;
+            }
+        }
+        return {};
+    }
+
     // Return an empty scoreboard for now
     std::vector<HighscoreRow> top_scores(int limit,
         const std::string& mode)
@@ -1,38 +1,19 @@
 #include "Enemy.hpp"
 #include <cmath>
 
+#include "SpriteBatch.hpp"
+
 static inline sf::Vector2f normalize(sf::Vector2f v) {
     float len = std::sqrt(v.x * v.x + v.y * v.y);
     return (len > 0.0001f) ? sf::Vector2f{ v.x / len, v.y / len } : sf::Vector2f{ 0.f, 0.f };
 }
 
-Enemy::Enemy(const std::shared_ptr<sf::Texture>& tex,
-    sf::Vector2f spawnPos,
+Enemy::Enemy(sf::Vector2f spawnPos,
     float speed,
     float radius)
-    : m_texture(tex),
-    m_position(spawnPos),
+    : m_position(spawnPos),
     m_speed(speed),
     m_radius(radius) {
-
-    if (m_texture) {
-        m_sprite = std::make_unique<sf::Sprite>(*m_texture); // SFML 3: texture required at construction
-        // center origin based on texture size
-        auto sz = m_texture->getSize();
-        m_sprite->setOrigin(sf::Vector2f{ static_cast<float>(sz.x) * 0.5f,
-                                          static_cast<float>(sz.y) * 0.5f });
-        m_sprite->setPosition(m_position);
-        m_sprite->setScale(sf::Vector2f{ (m_radius * 2.f) / static_cast<float>(sz.x),
-                                         (m_radius * 2.f) / static_cast<float>(sz.y) });
-    }
-    else {
-        m_shape = sf::CircleShape(m_radius);
-        m_shape.setOrigin(sf::Vector2f{ m_radius, m_radius });
-        m_shape.setFillColor(sf::Color(200, 60, 60));
-        m_shape.setOutlineThickness(2.f);
-        m_shape.setOutlineColor(sf::Color(255, 180, 180));
-        m_shape.setPosition(m_position);
-    }
 }
 
 void Enemy::update(float dt, sf::Vector2f playerPos) {
@@ -43,25 +24,57 @@ void Enemy::update(float dt, sf::Vector2f playerPos) {
     m_velocity = sf::Vector2f{ dir.x * m_speed, dir.y * m_speed };
     m_position += sf::Vector2f{ m_velocity.x * dt, m_velocity.y * dt };
 
-    if (m_sprite) {
-        m_sprite->setPosition(m_position);
-        // face the player (optional)
-        float angleRad = std::atan2(dir.y, dir.x);
-        m_sprite->setRotation(sf::degrees(angleRad * 180.f / 3.14159265f));
+    // simple eye-candy for the circle fallback: rotate a bit
+    m_spinDeg = std::fmod(m_spinDeg + 90.f * dt, 360.f);
+}
+
+void Enemy::draw(sf::RenderTarget& target, const sf::Texture* tex) const {
+    if (!m_alive) return;
+    if (tex) {
+        sf::Sprite sprite(*tex);
+        // center origin based on texture size
+        auto sz = tex->getSize();
+        sprite.setOrigin(sf::Vector2f{ static_cast<float>(sz.x) * 0.5f,
+                                       static_cast<float>(sz.y) * 0.5f });
+        sprite.setPosition(m_position);
+        sprite.setScale(sf::Vector2f{ (m_radius * 2.f) / static_cast<float>(sz.x),
+                                      (m_radius * 2.f) / static_cast<float>(sz.y) });
+        // face the player (direction of travel)
+        float angleRad = std::atan2(m_velocity.y, m_velocity.x);
+        sprite.setRotation(sf::degrees(angleRad * 180.f / 3.14159265f));
+        target.draw(sprite);
     }
     else {
-        m_shape.setPosition(m_position);
-        // simple eye-candy: rotate a bit
-        m_shape.setRotation(sf::degrees(m_shape.getRotation().asDegrees() + 90.f * dt));
+        // One shared fallback shape; only the render side ever draws
+        static sf::CircleShape shape = [] {
+            sf::CircleShape s;
+            s.setFillColor(sf::Color(200, 60, 60));
+            s.setOutlineThickness(2.f);
+            s.setOutlineColor(sf::Color(255, 180, 180));
+            return s;
+        }();
+        if (shape.getRadius() != m_radius) {
+            shape.setRadius(m_radius);
+            shape.setOrigin(sf::Vector2f{ m_radius, m_radius });
+        }
+        shape.setPosition(m_position);
+        shape.setRotation(sf::degrees(m_spinDeg));
+        target.draw(shape);
     }
 }
 
-void Enemy::draw(sf::RenderTarget& target) const {
+void Enemy::draw(SpriteBatch& batch, const GameSprites& sprites) const {
     if (!m_alive) return;
-    if (m_sprite) {
-        target.draw(*m_sprite);
+    const sf::Vector2f diameter{ m_radius * 2.f, m_radius * 2.f };
+    if (sprites.hasEnemy) {
+        // face the player (direction of travel)
+        const float angleRad = std::atan2(m_velocity.y, m_velocity.x);
+        batch.add(sprites.enemy, m_position, diameter, sf::degrees(angleRad * 180.f / 3.14159265f));
     }
     else {
-        target.draw(m_shape);
+        // outline ring = slightly larger disc underneath
+        const sf::Vector2f outline{ 4.f, 4.f };
+        batch.add(sprites.disc, m_position, diameter + outline, sf::Angle{}, sf::Color(255, 180, 180));
+        batch.add(sprites.disc, m_position, diameter, sf::Angle{}, sf::Color(200, 60, 60));
     }
 }
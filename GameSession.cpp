@@ -0,0 +1,316 @@
+#include "GameSession.hpp"
+#include <algorithm>
+
+// ============================================================================
+// ==================== Enemy: spawn helpers ==================================
+// ============================================================================
+// Just outside the camera rect (viewSize centred on the player), kept in the world
+static sf::Vector2f randomSpawnOnEdge(Pcg32& rng, sf::Vector2f center, const sf::Vector2u viewSize) {
+    const float w = static_cast<float>(viewSize.x);
+    const float h = static_cast<float>(viewSize.y);
+    const float left = center.x - w / 2.f;
+    const float top = center.y - h / 2.f;
+
+    sf::Vector2f local;
+    switch (rng.below(4)) { // 0=top,1=right,2=bottom,3=left
+    case 0: local = sf::Vector2f{ rng.uniform(0.f, w), -40.f }; break;     // top (offscreen)
+    case 1: local = sf::Vector2f{ w + 40.f, rng.uniform(0.f, h) }; break;  // right
+    case 2: local = sf::Vector2f{ rng.uniform(0.f, w), h + 40.f }; break;  // bottom
+    default:local = sf::Vector2f{ -40.f, rng.uniform(0.f, h) }; break;     // left
+    }
+    return world::clampToWorld(sf::Vector2f{ left + local.x, top + local.y });
+}
+
+static bool circleHit(sf::Vector2f a, float ra, sf::Vector2f b, float rb) {
+    float dx = a.x - b.x, dy = a.y - b.y;
+    float r = ra + rb;
+    return (dx * dx + dy * dy) <= (r * r);
+}
+// ============================================================================
+
+
+GameSession::GameSession(sf::Vector2u viewSize,
+    std::shared_ptr<sf::Texture> enemyTex,
+    std::uint64_t seed)
+    : m_viewSize(viewSize),
+    m_enemyTexture(std::move(enemyTex)) {
+    m_activeEnemies.reserve(SimState::MAX_ENEMIES);
+    m_fxEvents.reserve(SimState::MAX_SHOTS + 1);   // a shot kills at most one enemy, plus one player hit
+    reset(seed);
+}
+
+void GameSession::reset(std::uint64_t seed) {
+    m_state.rng.seed(seed);
+    reset();
+}
+
+void GameSession::reset() {
+    SimState& s = m_state;
+    s.player = Player{};
+    s.player.setPosition(sf::Vector2f{ world::WIDTH / 2.f, world::HEIGHT / 2.f });
+    s.score = 0;
+    s.lives = START_LIVES;
+    s.invulnTimer = 0.f;
+    s.hurtFlashTimer = 0.f;
+    s.shootCooldown = 0.f;
+    s.elapsed = 0.f;
+    s.tick = 0;
+    s.enemyCount = 0;
+    s.shotCount = 0;
+    s.awakeCount = 0;
+    s.awakeCenter = NO_CHUNK;
+    s.enemySpawnAccumulator = 0.f;
+    m_sleeperStatsDirty = true;
+}
+
+void GameSession::fire() {
+    SimState& s = m_state;
+    if (s.shotCount == SimState::MAX_SHOTS) return;   // pool exhausted: drop the shot
+    s.shots[s.shotCount++].fire(s.player.getMuzzle(), s.player.getForward());
+}
+
+void GameSession::spawnEnemy() {
+    SimState& s = m_state;
+    if (s.enemyCount == SimState::MAX_ENEMIES) evictFarthestEnemy();
+    auto pos = randomSpawnOnEdge(s.rng, s.player.getPosition(), m_viewSize);
+    // Spawns are next to the player, i.e. awake: first sleeper moves to the end
+    s.enemies[s.enemyCount++] = s.enemies[s.awakeCount];
+    s.enemies[s.awakeCount++] = Enemy(pos, s.enemySpeed, /*radius*/ 16.f);
+}
+
+// At the cap the enemy farthest from the player makes room for the new one:
+// usually a sleeper left behind in a chunk the player will never revisit, so
+// the arena keeps spawning instead of filling up with enemies that can't die.
+void GameSession::evictFarthestEnemy() {
+    SimState& s = m_state;
+    const sf::Vector2f p = s.player.getPosition();
+    std::uint32_t far = 0;
+    float farD2 = -1.f;
+    for (std::uint32_t i = 0; i < s.enemyCount; ++i) {
+        const float dx = s.enemies[i].position().x - p.x, dy = s.enemies[i].position().y - p.y;
+        const float d2 = dx * dx + dy * dy;
+        if (d2 > farD2) { farD2 = d2; far = i; }
+    }
+    // Keep awake [0, awakeCount) / sleepers [awakeCount, enemyCount)
+    if (far < s.awakeCount) {
+        s.enemies[far] = s.enemies[--s.awakeCount];
+        s.enemies[s.awakeCount] = s.enemies[--s.enemyCount];
+    }
+    else {
+        s.enemies[far] = s.enemies[--s.enemyCount];
+        m_sleeperStatsDirty = true;
+    }
+}
+
+// Sleepers never move, so the awake set only changes when the player enters
+// another chunk: stable-partition then (O(enemies), a few times a second at
+// most) instead of visiting every sleeper every tick.
+void GameSession::sortSleepers(ChunkCoord playerChunk) {
+    SimState& s = m_state;
+    Enemy* const enemies = s.enemies.data();
+    s.awakeCount = static_cast<std::uint32_t>(
+        std::stable_partition(enemies, enemies + s.enemyCount, [playerChunk](const Enemy& e) {
+            return activityAt(chunkOf(e.position()), playerChunk) != ChunkActivity::Sleeping;
+            }) - enemies);
+    s.awakeCenter = playerChunk;
+    countSleepers();
+}
+
+// Sleeping chunk/entity counts for ChunkStats (reads only; safe after restore())
+void GameSession::countSleepers() {
+    const SimState& s = m_state;
+    m_sleeperChunks.clear();
+    for (std::uint32_t i = s.awakeCount; i < s.enemyCount; ++i) {
+        const ChunkCoord c = chunkOf(s.enemies[i].position());
+        m_sleeperChunks.push_back((static_cast<std::uint64_t>(static_cast<std::uint32_t>(c.x)) << 32) |
+            static_cast<std::uint32_t>(c.y));
+    }
+    std::sort(m_sleeperChunks.begin(), m_sleeperChunks.end());
+    const auto chunks = std::unique(m_sleeperChunks.begin(), m_sleeperChunks.end()) - m_sleeperChunks.begin();
+    m_chunks.setSleepers(static_cast<std::size_t>(chunks), s.enemyCount - s.awakeCount);
+    m_sleeperStatsDirty = false;
+}
+
+void GameSession::step(float dt, const PlayerInput& input) {
+    m_fxEvents.clear();
+    if (isGameOver()) return;
+    SimState& s = m_state;
+    s.elapsed += dt;
+    ++s.tick;
+
+    // --- Timers ---
+    s.shootCooldown -= dt;
+    if (s.invulnTimer > 0.f)    s.invulnTimer -= dt;
+    if (s.hurtFlashTimer > 0.f) s.hurtFlashTimer -= dt;
+
+    // --- Player input + update ---
+    s.player.handleInput(input, dt);
+    s.player.setPosition(world::clampToWorld(s.player.getPosition()));
+    s.player.update(dt, input.aim);
+    const ChunkCoord playerChunk = chunkOf(s.player.getPosition());
+
+    // --- Fire control ---
+    if (input.fire && s.shootCooldown <= 0.f) {
+        fire();
+        s.shootCooldown = SHOOT_COOLDOWN_SEC;
+    }
+
+    Projectile* const shots = s.shots.data();
+    Enemy* const enemies = s.enemies.data();
+
+    // --- Projectiles update + cull once they leave the active chunks or the world ---
+    const sf::FloatRect active = activeRegion(playerChunk);
+    const sf::FloatRect worldRect = world::bounds();
+    for (std::uint32_t i = 0; i < s.shotCount; ++i) {
+        Projectile& p = shots[i];
+        p.update(dt);
+        if (p.outOf(active) || p.outOf(worldRect)) p.alive = false;
+    }
+
+    // --- Enemies: spawn + update toward player ---
+    const sf::Vector2f playerPosForAI = s.player.getMuzzle();
+    s.enemySpawnAccumulator += dt;
+    if (s.enemySpawnAccumulator >= s.enemySpawnEvery) {
+        s.enemySpawnAccumulator = 0.f;
+        spawnEnemy();
+    }
+    if (!(s.awakeCenter == playerChunk)) sortSleepers(playerChunk);
+    else if (m_sleeperStatsDirty) countSleepers();
+    m_chunks.beginTick(playerChunk, s.tick);
+    m_activeEnemies.clear();
+    for (std::uint32_t i = 0; i < s.awakeCount; ++i) {   // sleepers aren't visited at all
+        Enemy& e = enemies[i];
+        const ChunkTick ct = m_chunks.touch(e.position());
+        if (ct.dtScale == 0) continue;   // sleeping, or a coarse chunk off its turn
+        e.update(dt * static_cast<float>(ct.dtScale), playerPosForAI);
+        if (ct.activity == ChunkActivity::Active) m_activeEnemies.push_back(i);
+    }
+
+    // --- Collision: projectiles vs enemies (active chunks only) ---
+    for (std::uint32_t i : m_activeEnemies) {
+        Enemy& e = enemies[i];
+        if (!e.isAlive()) continue;
+        for (std::uint32_t j = 0; j < s.shotCount; ++j) {
+            Projectile& p = shots[j];
+            if (!p.alive) continue;
+            if (circleHit(p.getPosition(), PROJ_RADIUS, e.position(), e.radius())) {
+                p.alive = false;
+                e.kill();
+                s.score += 10;
+                m_fxEvents.push_back(FxEvent{ FxEvent::Type::EnemyKilled, e.position() });
+                break;
+            }
+        }
+    }
+
+    // --- Collision: enemies vs player (approx via muzzle position) ---
+    if (s.invulnTimer <= 0.f) {
+        for (std::uint32_t i : m_activeEnemies) {
+            Enemy& e = enemies[i];
+            if (!e.isAlive()) continue;
+            if (circleHit(playerPosForAI, PLAYER_RADIUS, e.position(), e.radius())) {
+                s.lives -= 1;
+                s.invulnTimer = INVULN_TIME_SEC;
+                s.hurtFlashTimer = HURT_FLASH_TIME_SEC;
+                e.kill();
+                m_fxEvents.push_back(FxEvent{ FxEvent::Type::PlayerHit, s.player.getPosition() });   // sparks on the ship, not the muzzle
+                break;
+            }
+        }
+    }
+
+    // --- GC: compact dead/expired entities ---
+    // Only awake enemies die: compact them in order, then refill the gap with
+    // the last sleepers (their order doesn't matter), O(kills) not O(enemies)
+    const std::uint32_t awakeAlive = static_cast<std::uint32_t>(
+        std::remove_if(enemies, enemies + s.awakeCount,
+            [](const Enemy& e) { return !e.isAlive(); }) - enemies);
+    const std::uint32_t sleepers = s.enemyCount - s.awakeCount;
+    const std::uint32_t refill = std::min(s.awakeCount - awakeAlive, sleepers);
+    std::copy(enemies + s.enemyCount - refill, enemies + s.enemyCount, enemies + awakeAlive);
+    s.awakeCount = awakeAlive;
+    s.enemyCount = awakeAlive + sleepers;
+    s.shotCount = static_cast<std::uint32_t>(
+        std::remove_if(shots, shots + s.shotCount,
+            [](const Projectile& p) { return !p.alive; }) - shots);
+}
+
+void GameSession::captureSnapshot(WorldSnapshot& out) const {
+    const SimState& s = m_state;
+    out.score = s.score;
+    out.lives = s.lives;
+    out.playerPosition = s.player.getPosition();
+    out.playerRotationDeg = s.player.getRotation().asDegrees();
+
+    out.enemies.resize(s.enemyCount);
+    for (std::uint32_t i = 0; i < s.enemyCount; ++i) {
+        const Enemy& e = s.enemies[i];
+        out.enemies[i] = EnemyRecord{ e.position(), e.velocity(), e.speed(), e.radius(), e.isAlive() };
+    }
+    out.shots.resize(s.shotCount);
+    for (std::uint32_t i = 0; i < s.shotCount; ++i) {
+        const Projectile& p = s.shots[i];
+        out.shots[i] = ShotRecord{ p.getPosition(), p.getVelocity(), p.alive };
+    }
+}
+
+void GameSession::applySnapshot(const WorldSnapshot& in) {
+    SimState& s = m_state;
+    s.score = in.score;
+    s.lives = in.lives;
+    s.player.setPosition(in.playerPosition);
+    s.player.setRotation(sf::degrees(in.playerRotationDeg));
+
+    s.enemyCount = static_cast<std::uint32_t>(std::min(in.enemies.size(), SimState::MAX_ENEMIES));
+    s.awakeCount = s.enemyCount;   // re-sorted on the next step
+    s.awakeCenter = NO_CHUNK;
+    for (std::uint32_t i = 0; i < s.enemyCount; ++i) {
+        const EnemyRecord& r = in.enemies[i];
+        Enemy& e = s.enemies[i];
+        e = Enemy(r.position, r.speed, r.radius);
+        e.setVelocity(r.velocity);
+        if (!r.alive) e.kill();
+    }
+    s.shotCount = static_cast<std::uint32_t>(std::min(in.shots.size(), SimState::MAX_SHOTS));
+    for (std::uint32_t i = 0; i < s.shotCount; ++i) {
+        const ShotRecord& r = in.shots[i];
+        s.shots[i] = Projectile{};
+        s.shots[i].restore(r.position, r.velocity, r.alive);
+    }
+}
+
+void GameSession::draw(sf::RenderWindow& window) const {
+    drawSimState(window, m_state, m_enemyTexture.get());
+}
+
+void drawSimState(sf::RenderWindow& window, const SimState& s, const sf::Texture* enemyTex) {
+    // Visible world rect (plus a margin for sprite extents)
+    const sf::View& view = window.getView();
+    const sf::Vector2f half = view.getSize() / 2.f + sf::Vector2f{ 64.f, 64.f };
+    const sf::FloatRect visible{ view.getCenter() - half, half * 2.f };
+
+    // ---- Player & projectiles
+    s.player.draw(window);
+    for (std::uint32_t i = 0; i < s.shotCount; ++i) s.shots[i].draw(window);
+
+    // ---- Enemies (skip everything off-camera)
+    for (std::uint32_t i = 0; i < s.enemyCount; ++i) {
+        const Enemy& e = s.enemies[i];
+        if (visible.contains(e.position())) e.draw(window, enemyTex);
+    }
+}
+
+void drawSimState(sf::RenderTarget& target, const SimState& s, const GameSprites& sprites, SpriteBatch& batch) {
+    const sf::View& view = target.getView();
+    const sf::Vector2f half = view.getSize() / 2.f + sf::Vector2f{ 64.f, 64.f };
+    const sf::FloatRect visible{ view.getCenter() - half, half * 2.f };
+
+    batch.clear();
+    s.player.draw(batch, sprites);
+    for (std::uint32_t i = 0; i < s.shotCount; ++i) s.shots[i].draw(batch, sprites);
+    for (std::uint32_t i = 0; i < s.enemyCount; ++i) {
+        const Enemy& e = s.enemies[i];
+        if (visible.contains(e.position())) e.draw(batch, sprites);
+    }
+    batch.draw(target, *sprites.page);
+}
@@ -0,0 +1,163 @@
+#include "Hud.hpp"
+#include <cstdio>
+
+static std::unique_ptr<sf::Text> makeText(const sf::Font& font, unsigned size, float outline, sf::Color fill) {
+    auto t = std::make_unique<sf::Text>(font);
+    t->setCharacterSize(size);
+    t->setFillColor(fill);
+    t->setOutlineColor(sf::Color(0, 0, 0));
+    t->setOutlineThickness(outline);
+    return t;
+}
+
+Hud::Hud(const sf::Font* font) {
+    if (font) {
+        m_scoreText = makeText(*font, 22, 2.f, sf::Color::White);
+        m_scoreText->setPosition(sf::Vector2f{ 12.f, 8.f });
+        m_livesText = makeText(*font, 22, 2.f, sf::Color::White);
+        m_livesText->setPosition(sf::Vector2f{ 12.f, 36.f });
+        m_infoText = makeText(*font, 26, 3.f, sf::Color::White);
+        m_debugText = makeText(*font, 14, 1.f, sf::Color(180, 255, 180));
+        m_debugText->setPosition(sf::Vector2f{ 12.f, 66.f });
+    }
+    m_gradient[0].color = sf::Color(10, 10, 40);
+    m_gradient[1].color = sf::Color(10, 10, 40);
+    m_gradient[2].color = sf::Color(30, 30, 100);
+    m_gradient[3].color = sf::Color(30, 30, 100);
+    m_flash.setFillColor(sf::Color(255, 255, 255, 120));
+}
+
+// ---- Setters: record the value, mark dirty only on a real change ----------
+
+void Hud::setWindowSize(sf::Vector2u size) {
+    if (size == m_size) return;
+    m_size = size;
+    m_sizeDirty = true;
+}
+
+void Hud::setScore(int score) {
+    if (score == m_score) return;
+    m_score = score;
+    m_scoreDirty = true;
+}
+
+void Hud::setLives(int lives) {
+    if (lives == m_lives) return;
+    m_lives = lives;
+    m_livesDirty = true;
+}
+
+void Hud::setScreen(HudScreen screen) {
+    if (screen == m_screen) return;
+    m_screen = screen;
+    m_infoDirty = true;
+}
+
+void Hud::setResults(int score, std::vector<HighscoreRow> rows) {
+    m_resultScore = score;
+    m_resultRows = std::move(rows);
+    if (m_screen == HudScreen::Results) m_infoDirty = true;
+}
+
+void Hud::setChunkStats(const ChunkStats& stats) {
+    if (stats == m_chunks) return;
+    m_chunks = stats;
+    m_debugDirty = true;
+}
+
+void Hud::setFrameTimeUs(float us) {
+    m_frameUs = us;
+    m_debugDirty = true;
+}
+
+// ---- Layout ----------------------------------------------------------------
+
+void Hud::centre(sf::Text& text) const {
+    const auto gb = text.getLocalBounds();
+    text.setPosition(sf::Vector2f{
+        (static_cast<float>(m_size.x) - gb.size.x) / 2.f - gb.position.x,
+        (static_cast<float>(m_size.y) - gb.size.y) / 2.f - gb.position.y
+        });
+}
+
+void Hud::layout() {
+    if (m_immediate) {
+        m_sizeDirty = m_scoreDirty = m_livesDirty = m_infoDirty = m_debugDirty = true;
+    }
+
+    if (m_sizeDirty) {
+        const float w = static_cast<float>(m_size.x);
+        const float h = static_cast<float>(m_size.y);
+        m_gradient[0].position = { 0.f, 0.f };
+        m_gradient[1].position = { w, 0.f };
+        m_gradient[2].position = { 0.f, h };
+        m_gradient[3].position = { w, h };
+        m_flash.setSize(sf::Vector2f{ w, h });
+        m_infoDirty = true;   // re-centre
+    }
+
+    if (m_scoreText) {
+        if (m_scoreDirty) m_scoreText->setString("Score: " + std::to_string(m_score));
+        if (m_livesDirty) m_livesText->setString("Lives: " + std::to_string(m_lives));
+
+        if (m_infoDirty) {
+            std::string s;
+            switch (m_screen) {
+            case HudScreen::Menu:
+                s = "ALIEN FORCE — DEMO\n\nEnter: Play   Esc: Quit\n\nWASD to move  •  Space/Click to shoot  •  F3: chunk stats\n\nF5: quick save   F9: quick load";
+                break;
+            case HudScreen::Paused:
+                s = "PAUSED\n\nEsc: Resume   R: Reset";
+                break;
+            case HudScreen::Results:
+                s = "GAME OVER\n\nScore: " + std::to_string(m_resultScore) + "\n\n";
+                if (!m_resultRows.empty()) {
+                    s += "TOP 5\n";
+                    int r = 1;
+                    for (const auto& row : m_resultRows) {
+                        s += std::to_string(r++) + ". " + row.name + "  " + std::to_string(row.score) + "  (" + row.when + ")\n";
+                    }
+                    s += "\n";
+                }
+                s += "Enter: Play Again   Esc: Close";
+                break;
+            case HudScreen::None:
+                break;
+            }
+            m_infoText->setString(s);
+            centre(*m_infoText);
+        }
+
+        if (m_debugDirty) {
+            char line[192];
+            std::snprintf(line, sizeof(line),
+                "chunks  active %zu  coarse %zu  sleeping %zu\n"
+                "enemies simulated %zu  sleeping %zu\n"
+                "ui+draw cpu %.1f us/frame  (%s, F4)",
+                m_chunks.active, m_chunks.coarse, m_chunks.sleeping,
+                m_chunks.simulatedEntities, m_chunks.sleepingEntities,
+                m_frameUs, m_immediate ? "immediate" : "retained");
+            m_debugText->setString(line);
+        }
+    }
+
+    m_sizeDirty = m_scoreDirty = m_livesDirty = m_infoDirty = m_debugDirty = false;
+}
+
+// ---- Draw ------------------------------------------------------------------
+
+void Hud::drawGradient(sf::RenderTarget& target) const {
+    target.draw(m_gradient);
+}
+
+void Hud::draw(sf::RenderTarget& target, bool scoreLine, bool showDebug, bool flash) const {
+    if (m_scoreText) {
+        if (scoreLine) {
+            target.draw(*m_scoreText);
+            target.draw(*m_livesText);
+        }
+        if (showDebug) target.draw(*m_debugText);
+        if (m_screen != HudScreen::None) target.draw(*m_infoText);
+    }
+    if (flash) target.draw(m_flash);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+//  Atlas — texture pages + named regions produced by AlienForceAtlasPacker.
+//
+//  Manifest (text, one entry per line, '#' comments):
+//      page   <index> <file> <width> <height>      file relative to manifest
+//      region <name> <page> <x> <y> <w> <h>        pixels
+//  Region names are the source path under Assets/ without extension, '/'
+//  separated ("enemy", "textures/enemy"). The packer also emits two built-in
+//  regions: "white" (solid, for tinted rectangles) and "disc" (anti-aliased
+//  circle, for tinted circles), so shapes can share the sprites' texture.
+// ============================================================================
+
+struct AtlasRegion {
+    std::uint32_t page{ 0 };
+    sf::IntRect   rect{};   // pixels in the page (SFML texCoords are pixels too)
+};
+
+class Atlas {
+public:
+    // Loads the manifest and every page it lists. Returns error text, empty on success.
+    std::string loadFromFile(const std::filesystem::path& manifest);
+
+    const AtlasRegion* find(std::string_view name) const;
+
+    std::size_t pageCount() const { return m_pages.size(); }
+    const sf::Texture& page(std::size_t i) const { return *m_pages[i]; }
+
+private:
+    std::vector<std::unique_ptr<sf::Texture>>    m_pages;
+    std::unordered_map<std::string, AtlasRegion> m_regions;
+};
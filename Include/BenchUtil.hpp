@@ -0,0 +1,43 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+//  BenchUtil — the bits every command-line tool shares (load test, batch
+//  runner, atlas packer, benchmarks): "--key value" options and percentiles.
+// ============================================================================
+namespace bench {
+
+    // Walks argv as "--key value" pairs, calling handle(key, value) for each.
+    // handle returns false for a key it doesn't know (warned, skipped); a
+    // trailing key without a value is warned about rather than dropped silently.
+    template <class Handler>
+    void parseOptions(int argc, char** argv, Handler handle) {
+        for (int i = 1; i < argc; i += 2) {
+            const std::string_view key = argv[i];
+            if (i + 1 >= argc) {
+                std::cout << "[WARN] option " << key << " needs a value\n";
+                break;
+            }
+            if (!handle(key, argv[i + 1])) std::cout << "[WARN] unknown option " << key << "\n";
+        }
+    }
+
+    // p in [0, 1] -> nearest-rank percentile of `samples` (reorders them; 0 if empty)
+    template <class T>
+    T percentile(std::vector<T>& samples, double p) {
+        if (samples.empty()) return T{};
+        const std::size_t idx = std::min(samples.size() - 1, static_cast<std::size_t>(p * (samples.size() - 1)));
+        std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+        return samples[idx];
+    }
+
+    // Nanosecond samples -> percentile in microseconds
+    inline double percentileUs(std::vector<std::int64_t>& ns, double p) {
+        return static_cast<double>(percentile(ns, p)) / 1000.0;
+    }
+}
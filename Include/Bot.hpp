@@ -0,0 +1,29 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+
+#include "Input.hpp"
+#include "SimState.hpp"   // Pcg32
+
+class GameSession;
+
+// ============================================================================
+//  Bot — scripted stand-in for a human player. Reads a session and produces
+//  the same PlayerInput the keyboard/mouse would:
+//    - aim at the nearest enemy (with a little jitter) and fire when one is
+//      in range,
+//    - back away and strafe when an enemy gets close,
+//    - otherwise wander around, steering away from the world edges.
+// ============================================================================
+class Bot {
+public:
+    explicit Bot(std::uint32_t seed);
+
+    PlayerInput think(const GameSession& session, float dt);
+
+private:
+    Pcg32        m_rng;   // not <random>: same decisions on every standard library
+    sf::Vector2f m_wanderTarget{ 0.f, 0.f };
+    float        m_wanderTimer{ 0.f };
+    float        m_strafeSign{ 1.f };
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,21 @@ struct HighscoreRow {
     std::string mode;   // e.g. "classic", "survival"
 };
 
+// One score to store. `id` is the ScoreJournal sequence number: a real backend
+// keeps it under a unique key so a replayed submission is never counted twice.
+struct ScoreSubmission {
+    std::uint64_t id{ 0 };
+    std::string   player;
+    int           score{ 0 };
+    std::string   mode;
+    std::int64_t  unixTime{ 0 };   // seconds, when the run ended
+};
+
+// Threading: the client calls into db:: from three threads at once --
+// top_scores from the render thread, upsert_player_and_add_score from the sim
+// thread (journal closed) and upsert_scores from the ScoreJournal writer.
+// Every function must therefore be thread-safe: a backend that shares one
+// connection has to serialize calls on it (one mutex in Db.cpp).
 namespace db {
 
     // Reads host/user/password/schema/port from cfg and tests connection.
@@ -26,6 +42,14 @@ namespace db {
     std::string upsert_player_and_add_score(const std::string& player_name,
         int score);
 
+    // Bulk insert (journal replay). Returns empty string when every row is
+    // stored, error text otherwise. No database is wired in yet: rows are
+    // forwarded one by one to upsert_player_and_add_score (id and unixTime
+    // unused), so an error can leave earlier rows stored and the journal
+    // replays them. A real backend should use one transaction with id as a
+    // unique key, making a replay a no-op.
+    std::string upsert_scores(const std::vector<ScoreSubmission>& rows);
+
     // Get top N scores for a given mode.
     std::vector<HighscoreRow> top_scores(int limit,
         const std::string& mode);
@@ -1,33 +1,40 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include <memory>
 
+class SpriteBatch;
+struct GameSprites;
+
+// Plain state only (trivially copyable) so the sim can be snapshotted with a
+// memcpy; the sprite / circle is built at draw time from a shared texture.
 class Enemy {
 public:
-    // If you have a texture to share across enemies, pass a shared_ptr to it (can be null)
-    explicit Enemy(const std::shared_ptr<sf::Texture>& tex,
-        sf::Vector2f spawnPos,
+    Enemy() = default;
+    explicit Enemy(sf::Vector2f spawnPos,
         float speed = 80.f,
         float radius = 16.f);
 
     void update(float dt, sf::Vector2f playerPos);
-    void draw(sf::RenderTarget& target) const;
+    // Render as sprite if a texture is given (can be null), otherwise as a circle shape
+    void draw(sf::RenderTarget& target, const sf::Texture* tex) const;
+    // Same look, appended to an atlas batch (enemy region, or tinted disc)
+    void draw(SpriteBatch& batch, const GameSprites& sprites) const;
 
     bool isAlive() const { return m_alive; }
     void kill() { m_alive = false; }
 
     sf::Vector2f position() const { return m_position; }
+    sf::Vector2f velocity() const { return m_velocity; }
     float radius() const { return m_radius; }
+    float speed() const { return m_speed; }
 
-private:
-    // Render as sprite if we have a texture, otherwise as a circle shape
-    std::shared_ptr<sf::Texture> m_texture;
-    std::unique_ptr<sf::Sprite>  m_sprite;   // SFML 3: construct with texture at creation
-    sf::CircleShape              m_shape;    // fallback
+    // Used when loading a saved world (velocity is otherwise derived in update)
+    void setVelocity(sf::Vector2f v) { m_velocity = v; }
 
+private:
     sf::Vector2f m_position{};
     sf::Vector2f m_velocity{};
     float        m_speed{ 80.f };
     float        m_radius{ 16.f };
+    float        m_spinDeg{ 0.f };   // circle fallback eye-candy
     bool         m_alive{ true };
 };
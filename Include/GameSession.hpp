@@ -0,0 +1,115 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Input.hpp"
+#include "SimState.hpp"
+#include "SpriteBatch.hpp"
+#include "World.hpp"
+#include "WorldSerializer.hpp"
+
+// Something visible happened this tick (render-side effects only; not sim state)
+struct FxEvent {
+    enum class Type : std::uint8_t { EnemyKilled, PlayerHit };
+    Type         type{ Type::EnemyKilled };
+    sf::Vector2f position{};
+};
+
+// ============================================================================
+//  GameSession — one arena run (player, shots, enemies, score/lives, timers).
+//  Owns no window and polls no devices: the client feeds it the local
+//  player's input, the load tester feeds it Bot input, one session per bot.
+//  The arena is the chunked world (World.hpp); the view size only decides
+//  where enemies spawn (just off-camera around the player).
+//  All tick state lives in one SimState block, so snapshot()/restore() are
+//  plain copies (rollback, see RollbackBuffer in SimState.hpp).
+// ============================================================================
+class GameSession {
+public:
+    static constexpr int   START_LIVES = 3;
+    static constexpr float INVULN_TIME_SEC = 1.0f;   // after player is hit
+    static constexpr float HURT_FLASH_TIME_SEC = 0.15f;  // white flash overlay
+    static constexpr float PROJ_RADIUS = 3.0f;   // projectile hit circle
+    static constexpr float PLAYER_RADIUS = 18.f;   // approx hit circle around muzzle
+    static constexpr float SHOOT_COOLDOWN_SEC = 0.12f;
+
+    // enemyTex may be null (headless sessions / circle fallback)
+    explicit GameSession(sf::Vector2u viewSize,
+        std::shared_ptr<sf::Texture> enemyTex = nullptr,
+        std::uint64_t seed = std::random_device{}());
+
+    // Start a fresh run (score, lives, entities, timers); keeps the RNG stream
+    void reset();
+    // Same, but also reseeds the RNG (reproducible runs)
+    void reset(std::uint64_t seed);
+
+    // Advance the arena by dt using this tick's input. No-op once game over.
+    void step(float dt, const PlayerInput& input);
+
+    // Whole-sim copy out / back in (microseconds: SimState is trivially copyable)
+    void snapshot(SimState& out) const { out = m_state; }
+    void restore(const SimState& in) { m_state = in; m_sleeperStatsDirty = true; }
+    const SimState& state() const { return m_state; }
+
+    // Copy the serializable world (score, lives, player, enemies, shots) out / back in.
+    // apply() keeps timers and the RNG as they are.
+    void captureSnapshot(WorldSnapshot& out) const;
+    void applySnapshot(const WorldSnapshot& in);
+
+    // Draws entities inside the window's current view (camera)
+    void draw(sf::RenderWindow& window) const;
+
+    // Enemy spawn cadence in seconds (kept across reset())
+    void setSpawnInterval(float seconds) { m_state.enemySpawnEvery = seconds; }
+    // Speed of newly spawned enemies in px/s (kept across reset())
+    void setEnemySpeed(float pxPerSec) { m_state.enemySpeed = pxPerSec; }
+
+    void setViewSize(sf::Vector2u size) { m_viewSize = size; }
+    sf::Vector2u viewSize() const { return m_viewSize; }
+    const ChunkStats& chunkStats() const { return m_chunks.stats(); }
+
+    int   score() const { return m_state.score; }
+    int   lives() const { return m_state.lives; }
+    bool  isGameOver() const { return m_state.lives <= 0; }
+    float hurtFlashTimer() const { return m_state.hurtFlashTimer; }
+    float elapsed() const { return m_state.elapsed; }   // arena seconds this run
+    std::uint64_t tick() const { return m_state.tick; }
+
+    const Player& player() const { return m_state.player; }
+    std::span<const Enemy> enemies() const { return { m_state.enemies.data(), m_state.enemyCount }; }
+    std::span<const Projectile> shots() const { return { m_state.shots.data(), m_state.shotCount }; }
+
+    // Kills / hits of the last step() (cleared at the start of every step)
+    std::span<const FxEvent> fxEvents() const { return m_fxEvents; }
+
+private:
+    void fire();
+    void spawnEnemy();
+    void evictFarthestEnemy();
+    void sortSleepers(ChunkCoord playerChunk);
+    void countSleepers();
+
+    SimState m_state;
+
+    // Not sim state: render resource, spawn framing and per-tick scratch
+    sf::Vector2u                 m_viewSize;
+    std::shared_ptr<sf::Texture> m_enemyTexture;   // shared by all enemies (keeps VRAM copies low)
+
+    // Chunk activity + enemies that ticked at full rate (collision candidates)
+    ChunkMap                   m_chunks;
+    std::vector<std::uint32_t> m_activeEnemies;
+    std::vector<FxEvent>       m_fxEvents;
+    std::vector<std::uint64_t> m_sleeperChunks;        // scratch for countSleepers()
+    bool                       m_sleeperStatsDirty{ true };
+};
+
+// Draw a sim state (e.g. a RenderFrame copy) inside the window's current view.
+// enemyTex may be null (circle fallback).
+void drawSimState(sf::RenderWindow& window, const SimState& s, const sf::Texture* enemyTex);
+// Same, but every entity goes into `batch` and is drawn with one bind of the
+// atlas page (sprites must be resolved).
+void drawSimState(sf::RenderTarget& target, const SimState& s, const GameSprites& sprites, SpriteBatch& batch);
@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Db.hpp"
+#include "World.hpp"
+
+// Which centred panel the HUD shows over the scene
+enum class HudScreen { None, Menu, Paused, Results };
+
+// ============================================================================
+//  Hud — retained-mode screen-space UI: score/lives, the centred Menu /
+//  Paused / Results panel, the F3 debug line, the gradient background and
+//  the hurt flash. Geometry is built once; setters only mark what changed
+//  and the next draw re-lays-out just that (setString + centring). With the
+//  window size, score, lives and screen unchanged a frame does no text work.
+//
+//  setImmediateMode(true) re-lays-out everything every frame, which is what
+//  the client used to do; kept so the two can be compared (F4 in the client).
+// ============================================================================
+class Hud {
+public:
+    // font may be null (no font found): only gradient + flash are drawn
+    explicit Hud(const sf::Font* font);
+
+    void setWindowSize(sf::Vector2u size);
+    void setScore(int score);
+    void setLives(int lives);
+    void setScreen(HudScreen screen);
+    // Results panel contents; rows are cached here (query the DB once per run)
+    void setResults(int score, std::vector<HighscoreRow> rows);
+    void setChunkStats(const ChunkStats& stats);
+    void setFrameTimeUs(float us);
+    void setImmediateMode(bool on) { m_immediate = on; m_debugDirty = true; }
+    bool immediateMode() const { return m_immediate; }
+
+    // Apply pending changes (call once per frame, before drawing)
+    void layout();
+
+    // Background fallback when there is no background image
+    void drawGradient(sf::RenderTarget& target) const;
+    // Score/lives (scoreLine), centred panel, debug line (if showDebug), flash (if flash)
+    void draw(sf::RenderTarget& target, bool scoreLine, bool showDebug, bool flash) const;
+
+private:
+    void centre(sf::Text& text) const;
+
+    std::unique_ptr<sf::Text> m_scoreText;
+    std::unique_ptr<sf::Text> m_livesText;
+    std::unique_ptr<sf::Text> m_infoText;
+    std::unique_ptr<sf::Text> m_debugText;
+    sf::VertexArray           m_gradient{ sf::PrimitiveType::TriangleStrip, 4 };
+    sf::RectangleShape        m_flash;
+
+    // Current values
+    sf::Vector2u m_size{ 0u, 0u };
+    int          m_score{ 0 };
+    int          m_lives{ 0 };
+    HudScreen    m_screen{ HudScreen::None };
+    int          m_resultScore{ 0 };
+    std::vector<HighscoreRow> m_resultRows;
+    ChunkStats   m_chunks{};
+    float        m_frameUs{ 0.f };
+    bool         m_immediate{ false };
+
+    // Dirty flags (set by the setters, cleared by layout)
+    bool m_sizeDirty{ true };
+    bool m_scoreDirty{ true };
+    bool m_livesDirty{ true };
+    bool m_infoDirty{ true };
+    bool m_debugDirty{ true };
+};
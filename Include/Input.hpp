@@ -0,0 +1,15 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// One tick worth of player intent. The local player fills this from the
+// keyboard/mouse, scripted sessions fill it from a Bot; Player and
+// GameSession never poll input devices themselves.
+struct PlayerInput {
+    sf::Vector2f move{ 0.f, 0.f };   // -1..1 per axis (WASD)
+    sf::Vector2f aim{ 0.f, 0.f };    // world-space point the player faces
+    bool         fire{ false };      // Space / left mouse held
+};
+
+// Samples WASD, the mouse position (mapped through the window's current view)
+// and Space/Left click.
+PlayerInput pollLocalInput(const sf::RenderWindow& window);
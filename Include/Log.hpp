@@ -0,0 +1,264 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// ============================================================================
+//  Log — asynchronous diagnostics. A log call copies its arguments (raw
+//  numbers, string bytes) into a slot of the calling thread's own lock-free
+//  ring (SpscQueue); a background thread drains every ring, does the printf
+//  formatting, orders records by time and writes them to stdout or a file.
+//  The calling thread never formats, never touches the console or a pipe and
+//  never takes a lock (a full ring drops the record and counts it).
+//
+//  Usage:  AF_LOG_INFO("DB", "score saved (%d)", score);
+//  tag and format are stored by pointer: pass string literals. Arguments may
+//  be arithmetic types, C strings or std::string (strings are copied and
+//  truncated to fit the record). A call without arguments prints the format
+//  verbatim. The format is checked against the arguments at compile time
+//  (count, and each conversion against the stored type, e.g. %zu needs a
+//  size_t-sized integer, %s a string), since the printf call itself only
+//  happens later, on the drain thread, where the compiler can't see it.
+//
+//  Records below ALIENFORCE_LOG_MIN_LEVEL compile to nothing (arguments are
+//  not evaluated). Define it to 0 to keep Debug, 2 to keep only Warn/Error.
+// ============================================================================
+
+enum class LogLevel : std::uint8_t { Debug = 0, Info = 1, Warn = 2, Error = 3 };
+
+#ifndef ALIENFORCE_LOG_MIN_LEVEL
+#define ALIENFORCE_LOG_MIN_LEVEL 1
+#endif
+
+namespace logging {
+
+    // Start the drain thread. path == nullptr -> stdout; otherwise append to file.
+    // Records logged before start() are kept (up to ring capacity) and written then.
+    // Returns an error message, or empty on success.
+    std::string start(const char* path = nullptr);
+
+    // Drain everything still queued, then stop the thread and close the file.
+    void stop();
+
+    // Records dropped because a thread's ring was full (all threads, so far)
+    std::uint64_t dropped();
+
+    namespace detail {
+
+        static constexpr std::size_t ARG_BYTES = 216;
+        static constexpr std::size_t MAX_STRING = 160;   // per string argument, so one long path can't starve the rest
+
+        using FormatFn = int (*)(const unsigned char* args, const char* fmt, char* out, std::size_t cap);
+
+        struct Record {
+            std::int64_t  ns;           // stamped by commit()
+            FormatFn      format;
+            const char*   fmt;
+            const char*   tag;
+            LogLevel      level;
+            std::uint16_t thread;
+            unsigned char args[ARG_BYTES];
+        };
+
+        // Calling thread's ring: next free record (nullptr when full), then commit
+        Record* claim();
+        void    commit(Record& rec);
+
+        // ---- Argument packing: what each argument is stored (and printed) as ----
+        template <class T>
+        using Stored = std::conditional_t<
+            std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*> ||
+            std::is_same_v<std::decay_t<T>, std::string> || std::is_same_v<std::decay_t<T>, std::string_view>,
+            const char*,
+            std::conditional_t<std::is_floating_point_v<std::decay_t<T>>, double,
+            std::conditional_t<std::is_integral_v<std::decay_t<T>> && sizeof(std::decay_t<T>) < sizeof(int), int,
+            std::decay_t<T>>>>;
+
+        inline std::string_view asView(const char* s) { return s ? std::string_view{ s } : std::string_view{ "(null)" }; }
+        inline std::string_view asView(const std::string& s) { return s; }
+        inline std::string_view asView(std::string_view s) { return s; }
+
+        // Bytes an argument needs at minimum (strings: length + NUL)
+        template <class T>
+        constexpr std::size_t fixedSize() {
+            return std::is_same_v<Stored<T>, const char*> ? sizeof(std::uint16_t) + 1 : sizeof(Stored<T>);
+        }
+
+        // Strings: [uint16 length][bytes][NUL], truncated so they end before `end`
+        // (write() keeps room for the arguments that follow)
+        template <class T>
+        void pack(unsigned char*& p, const unsigned char* end, const T& v) {
+            using S = Stored<T>;
+            if constexpr (std::is_same_v<S, const char*>) {
+                const std::string_view s = asView(v);
+                const std::size_t room = static_cast<std::size_t>(end - p);
+                const std::size_t n = std::min({ s.size(), MAX_STRING, room - sizeof(std::uint16_t) - 1 });
+                const std::uint16_t len = static_cast<std::uint16_t>(n);
+                std::memcpy(p, &len, sizeof(len));
+                std::memcpy(p + sizeof(len), s.data(), n);
+                p[sizeof(len) + n] = '\0';
+                p += sizeof(len) + n + 1;
+            }
+            else {
+                static_assert(std::is_arithmetic_v<S> || std::is_pointer_v<S>, "log arguments: numbers, pointers or strings");
+                const S s = static_cast<S>(v);
+                std::memcpy(p, &s, sizeof(S));
+                p += sizeof(S);
+            }
+        }
+
+        template <class S>
+        S unpack(const unsigned char*& p) {
+            if constexpr (std::is_same_v<S, const char*>) {
+                std::uint16_t len;
+                std::memcpy(&len, p, sizeof(len));
+                const char* s = reinterpret_cast<const char*>(p + sizeof(len));
+                p += sizeof(len) + len + 1;
+                return s;
+            }
+            else {
+                S s;
+                std::memcpy(&s, p, sizeof(S));
+                p += sizeof(S);
+                return s;
+            }
+        }
+
+        // ---- Compile-time format check ----
+        struct FormatArg {
+            enum Kind : std::uint8_t { Integer, Floating, String, Pointer } kind;
+            std::size_t size;   // integers: sizeof
+        };
+
+        template <class S>
+        consteval FormatArg formatArgOf() {
+            if constexpr (std::is_same_v<S, const char*>) return { FormatArg::String, 0 };
+            else if constexpr (std::is_floating_point_v<S>) return { FormatArg::Floating, 0 };
+            else if constexpr (std::is_pointer_v<S>) return { FormatArg::Pointer, 0 };
+            else return { FormatArg::Integer, sizeof(S) };
+        }
+
+        // true when every conversion in fmt matches the stored argument types
+        // (integers by size, not sign) and the counts agree
+        template <class... S>
+        consteval bool formatMatches(std::string_view fmt) {
+            if constexpr (sizeof...(S) == 0) {
+                return true;   // printed verbatim
+            }
+            else {
+                const FormatArg args[] = { formatArgOf<S>()... };
+                std::size_t next = 0;
+                const auto takeInt = [&](std::size_t size) {
+                    return next < sizeof...(S) && args[next].kind == FormatArg::Integer && args[next++].size == size;
+                    };
+                for (std::size_t i = 0; i < fmt.size(); ++i) {
+                    if (fmt[i] != '%') continue;
+                    if (++i < fmt.size() && fmt[i] == '%') continue;
+                    while (i < fmt.size() && std::string_view("-+ #0").find(fmt[i]) != std::string_view::npos) ++i;
+                    if (i < fmt.size() && fmt[i] == '*') { if (!takeInt(sizeof(int))) return false; ++i; }
+                    while (i < fmt.size() && fmt[i] >= '0' && fmt[i] <= '9') ++i;
+                    if (i < fmt.size() && fmt[i] == '.') {
+                        ++i;
+                        if (i < fmt.size() && fmt[i] == '*') { if (!takeInt(sizeof(int))) return false; ++i; }
+                        while (i < fmt.size() && fmt[i] >= '0' && fmt[i] <= '9') ++i;
+                    }
+                    std::size_t intSize = sizeof(int);   // h/hh arguments arrive promoted to int
+                    while (i < fmt.size() && std::string_view("hlzjtL").find(fmt[i]) != std::string_view::npos) {
+                        if (fmt[i] == 'l') intSize = fmt[i - 1] == 'l' ? sizeof(long long) : sizeof(long);
+                        else if (fmt[i] == 'z') intSize = sizeof(std::size_t);
+                        else if (fmt[i] == 'j') intSize = sizeof(std::intmax_t);
+                        else if (fmt[i] == 't') intSize = sizeof(std::ptrdiff_t);
+                        ++i;
+                    }
+                    if (i >= fmt.size()) return false;
+                    switch (fmt[i]) {
+                    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+                        if (!takeInt(intSize)) return false;
+                        break;
+                    case 'c':
+                        if (!takeInt(sizeof(int))) return false;
+                        break;
+                    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                        if (next >= sizeof...(S) || args[next++].kind != FormatArg::Floating) return false;
+                        break;
+                    case 's':
+                        if (next >= sizeof...(S) || args[next++].kind != FormatArg::String) return false;
+                        break;
+                    case 'p':
+                        if (next >= sizeof...(S) || args[next++].kind != FormatArg::Pointer) return false;
+                        break;
+                    default:
+                        return false;   // %n or unknown
+                    }
+                }
+                return next == sizeof...(S);
+            }
+        }
+
+        // Not constexpr on purpose: reaching it makes the AF_LOG_* call fail to compile
+        void log_format_does_not_match_arguments();
+
+        // Format string of a log call with these argument types; only
+        // constructible from a literal that matches them
+        template <class... Args>
+        struct FormatString {
+            const char* str;
+
+            template <std::size_t N>
+            consteval FormatString(const char (&literal)[N]) : str(literal) {
+                if (!formatMatches<Stored<Args>...>(std::string_view(literal, N - 1))) log_format_does_not_match_arguments();
+            }
+        };
+
+        // Runs on the drain thread
+        template <class... S>
+        int formatRecord(const unsigned char* args, const char* fmt, char* out, std::size_t cap) {
+            if constexpr (sizeof...(S) == 0) {
+                return std::snprintf(out, cap, "%s", fmt);
+            }
+            else {
+                const std::tuple<S...> values{ unpack<S>(args)... };   // braced init: left to right
+                return std::apply([&](auto... v) { return std::snprintf(out, cap, fmt, v...); }, values);
+            }
+        }
+
+        template <class... Args>
+        void write(LogLevel level, const char* tag, FormatString<std::type_identity_t<Args>...> format, const Args&... args) {
+            const char* fmt = format.str;
+            constexpr std::size_t fixedTotal = (fixedSize<Args>() + ... + 0);
+            static_assert(fixedTotal <= ARG_BYTES, "too many log arguments for one record");
+
+            Record* rec = claim();
+            if (!rec) return;   // ring full: counted as dropped
+            rec->format = &formatRecord<Stored<Args>...>;
+            rec->fmt = fmt;
+            rec->tag = tag;
+            rec->level = level;
+            if constexpr (sizeof...(Args) > 0) {
+                unsigned char* p = rec->args;
+                std::size_t reserve = fixedTotal;   // bytes still owed to the remaining arguments
+                ((reserve -= fixedSize<Args>(), pack(p, rec->args + ARG_BYTES - reserve, args)), ...);
+            }
+            commit(*rec);
+        }
+
+    } // namespace detail
+
+} // namespace logging
+
+#define AF_LOG(level, tag, ...)                                                  \
+    do {                                                                         \
+        if constexpr (static_cast<int>(level) >= ALIENFORCE_LOG_MIN_LEVEL)       \
+            ::logging::detail::write(level, tag, __VA_ARGS__);                   \
+    } while (0)
+
+#define AF_LOG_DEBUG(tag, ...) AF_LOG(LogLevel::Debug, tag, __VA_ARGS__)
+#define AF_LOG_INFO(tag, ...)  AF_LOG(LogLevel::Info, tag, __VA_ARGS__)
+#define AF_LOG_WARN(tag, ...)  AF_LOG(LogLevel::Warn, tag, __VA_ARGS__)
+#define AF_LOG_ERROR(tag, ...) AF_LOG(LogLevel::Error, tag, __VA_ARGS__)
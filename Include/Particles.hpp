@@ -0,0 +1,76 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "SimState.hpp"      // Pcg32
+#include "SpriteBatch.hpp"   // GameSprites
+
+// One explosion / spark request: `count` particles flying out of `position`
+struct ParticleBurst {
+    sf::Vector2f  position{};
+    sf::Color     color{ sf::Color::White };
+    std::uint32_t count{ 16 };
+    float         speed{ 200.f };   // max initial speed, px/s
+    float         life{ 0.6f };     // seconds (jittered down to 60%)
+    float         size{ 5.f };      // px, shrinks to half over the lifetime
+};
+
+// Global limits: the cost of a frame is bounded by these, however many
+// enemies die in one tick.
+struct ParticleBudget {
+    std::size_t capacity = 8192;        // live particles (pool size, never grows)
+    std::size_t spawnPerFrame = 2048;   // new particles per emit() call
+};
+
+// ============================================================================
+//  ParticleSystem — fixed-capacity pool of short-lived sparks, stored as
+//  structure-of-arrays so update() is a handful of straight float loops the
+//  compiler vectorizes. Dead particles are swap-removed, so the live ones are
+//  always [0, size()). draw() writes every live particle into one reused
+//  vertex array and issues a single draw call (disc region of the atlas page
+//  when sprites are given, plain quads otherwise).
+//  Render thread only; fed from SimThread::pollFx().
+// ============================================================================
+class ParticleSystem {
+public:
+    explicit ParticleSystem(ParticleBudget budget = {});
+
+    // Reallocates the pool and drops live particles
+    void setBudget(ParticleBudget budget);
+    const ParticleBudget& budget() const { return m_budget; }
+
+    // Spawns the bursts, scaled down together when they ask for more than the
+    // frame's spawn budget or the free pool (each keeps its share).
+    void emit(std::span<const ParticleBurst> bursts);
+    void update(float dt);
+    // CPU half of draw(): live particles -> vertices() (6 per particle).
+    // Separate so the benchmark can time it without a window.
+    void buildVertices(const GameSprites* sprites);
+    void draw(sf::RenderTarget& target, const GameSprites* sprites);   // buildVertices + one draw call
+    const sf::VertexArray& vertices() const { return m_vertices; }
+    void clear() { m_count = 0; }
+
+    std::size_t size() const { return m_count; }
+    std::uint64_t dropped() const { return m_dropped; }   // requested but not spawned (budget)
+
+private:
+    void spawn(const ParticleBurst& b, std::uint32_t n);
+
+    ParticleBudget m_budget;
+    std::size_t    m_count{ 0 };
+    std::uint64_t  m_dropped{ 0 };
+    Pcg32          m_rng;
+
+    // SoA pool, all sized to capacity
+    std::vector<float>     m_px, m_py;
+    std::vector<float>     m_vx, m_vy;
+    std::vector<float>     m_age;       // 0..1 of the lifetime
+    std::vector<float>     m_ageRate;   // 1 / life
+    std::vector<float>     m_size;
+    std::vector<sf::Color> m_color;
+
+    sf::VertexArray m_vertices{ sf::PrimitiveType::Triangles };
+};
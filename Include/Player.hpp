@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Input.hpp"
+
+class SpriteBatch;
+struct GameSprites;
+
+// Plain state only (trivially copyable); the body rectangle is a shared shape
+// built at draw time.
+class Player {
+public:
+    Player() = default;
+
+    // Movement from the tick's input (no device polling here)
+    void handleInput(const PlayerInput& input, float dt);
+    // Face the given world-space point
+    void update(float dt, sf::Vector2f aimTarget);
+    void draw(sf::RenderWindow& window) const;
+    void draw(SpriteBatch& batch, const GameSprites& sprites) const;   // tinted white quad
+
+    sf::Vector2f getMuzzle() const;
+    sf::Vector2f getForward() const;
+    sf::Vector2f getPosition() const { return position; }
+    void setPosition(sf::Vector2f p) { position = p; }
+    sf::Angle getRotation() const { return rotation; }
+    void setRotation(sf::Angle a) { rotation = a; }
+
+private:
+    sf::Vector2f position{ 400.f, 300.f };
+    sf::Angle    rotation{};
+    float        speed{ 300.f };
+};
@@ -0,0 +1,91 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Db.hpp"   // ScoreSubmission
+
+// ============================================================================
+//  ScoreJournal — crash-safe local queue of score submissions in front of the
+//  database. submit() only appends to an in-memory batch and returns; a
+//  background thread writes the batch as one group commit (one write + one
+//  fsync, however many scores arrived together), then hands every durable,
+//  unacknowledged score to the sink in bulk. When the sink accepts them an
+//  ack record is appended and synced; once everything is acked and the file has grown
+//  past compactBytes it is rewritten down to a few bytes. On open(), entries
+//  a previous process wrote but never got acked (crash, DB down) are
+//  replayed first.
+//
+//  File (little-endian): "AFSJ" u32 version, then frames
+//      u32 payloadLength | u32 crc32(payload) | payload
+//  payload: u8 kind
+//      Submit  u64 id | i64 unixTime | i32 score | u16 len + player | u16 len + mode
+//      Ack     u64 id   (every submission with id <= this is stored)
+//  A torn or corrupt tail (crash mid-write) is cut off at the last good frame.
+// ============================================================================
+
+struct JournalOptions {
+    std::chrono::milliseconds commitWindow{ 2 };       // gather a burst before the fsync
+    std::chrono::milliseconds retryInterval{ 5000 };   // sink failed (DB down): retry after
+    std::size_t               maxBulk = 256;           // rows per sink call
+    std::uintmax_t            compactBytes = 64 * 1024;
+};
+
+class ScoreJournal {
+public:
+    // Stores rows in bulk. Returns error text, empty when every row is stored.
+    using Sink = std::function<std::string(const std::vector<ScoreSubmission>&)>;
+
+    ScoreJournal(std::filesystem::path path, Sink sink, JournalOptions options = {});
+    ~ScoreJournal();
+
+    ScoreJournal(const ScoreJournal&) = delete;
+    ScoreJournal& operator=(const ScoreJournal&) = delete;
+
+    // Loads/repairs the file, queues un-acked entries for replay and starts the
+    // writer thread. Returns error text, empty on success.
+    std::string open();
+    // Commits whatever is queued, tries the sink once more, joins. Safe to call twice.
+    void stop();
+
+    // Any thread; never waits on disk or the database. Returns the entry id (0 if not open).
+    std::uint64_t submit(const std::string& player, int score, const std::string& mode);
+
+    std::uint64_t durableId() const;   // highest id known to be on disk
+    std::uint64_t ackedId() const;     // highest id the sink has stored
+
+private:
+    void run();
+    bool commit(std::vector<ScoreSubmission>& batch);
+    bool deliver();
+    void compact();
+    bool reopen();
+    bool appendFrames(const std::vector<std::uint8_t>& bytes, bool sync);
+
+    const std::filesystem::path m_path;
+    const Sink                  m_sink;
+    const JournalOptions        m_options;
+
+    // Shared with submitters (guarded by m_mutex)
+    mutable std::mutex           m_mutex;
+    std::condition_variable      m_wake;
+    std::vector<ScoreSubmission> m_incoming;
+    std::uint64_t                m_nextId{ 1 };
+    std::uint64_t                m_durableId{ 0 };
+    std::uint64_t                m_ackedId{ 0 };
+    bool                         m_open{ false };
+    bool                         m_stopping{ false };
+
+    // Writer thread only
+    std::FILE*                   m_file{ nullptr };
+    std::vector<ScoreSubmission> m_unacked;   // durable, waiting for the sink, id order
+    std::chrono::steady_clock::time_point m_nextDelivery{};
+    std::thread                  m_thread;
+};
@@ -0,0 +1,121 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Enemy.hpp"
+#include "Input.hpp"
+#include "Player.hpp"
+#include "Projectile.hpp"
+#include "World.hpp"
+
+// ============================================================================
+//  SimState — everything a GameSession tick reads or writes, in one trivially
+//  copyable block: entities in fixed-capacity arrays, timers, spawn cadence
+//  and the RNG. snapshot/restore is a plain struct copy, which is what
+//  rollback-style correction needs (save/restore many times per tick).
+// ============================================================================
+
+// PCG32 (O'Neill): 16 bytes of state, same sequence on every platform,
+// unlike std::mt19937 + std:: distributions.
+struct Pcg32 {
+    std::uint64_t state{ 0x853c49e6748fea9bull };
+    std::uint64_t inc{ 0xda3e39cb94b95bdbull };
+
+    void seed(std::uint64_t initState, std::uint64_t stream = 0x54u) {
+        state = 0u;
+        inc = (stream << 1u) | 1u;
+        next();
+        state += initState;
+        next();
+    }
+
+    std::uint32_t next() {
+        const std::uint64_t old = state;
+        state = old * 6364136223846793005ull + inc;
+        const std::uint32_t xorshifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const std::uint32_t rot = static_cast<std::uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+    }
+
+    // [0, 1)
+    float nextFloat() { return static_cast<float>(next() >> 8) * (1.f / 16777216.f); }
+    float uniform(float lo, float hi) { return lo + (hi - lo) * nextFloat(); }
+    // [0, n)
+    std::uint32_t below(std::uint32_t n) { return static_cast<std::uint32_t>((static_cast<std::uint64_t>(next()) * n) >> 32); }
+};
+
+struct SimState {
+    static constexpr std::size_t MAX_ENEMIES = 1024;
+    static constexpr std::size_t MAX_SHOTS = 256;
+
+    Player player;
+    std::array<Enemy, MAX_ENEMIES>     enemies;
+    std::array<Projectile, MAX_SHOTS>  shots;
+    std::uint32_t enemyCount{ 0 };
+    std::uint32_t shotCount{ 0 };
+    // enemies[0, awakeCount) are within COARSE_RADIUS of awakeCenter, the rest
+    // sleep (frozen). Re-sorted only when the player enters another chunk.
+    std::uint32_t awakeCount{ 0 };
+    ChunkCoord    awakeCenter{ NO_CHUNK };
+
+    int   score{ 0 };
+    int   lives{ 0 };
+    float invulnTimer{ 0.f };       // player invulnerability after being hit
+    float hurtFlashTimer{ 0.f };    // brief white flash overlay
+    float shootCooldown{ 0.f };
+    float elapsed{ 0.f };           // arena seconds this run
+    std::uint64_t tick{ 0 };
+
+    // Spawn timing
+    float enemySpawnAccumulator{ 0.f };
+    float enemySpawnEvery{ 1.75f }; // seconds
+    float enemySpeed{ 80.f };       // px/s for newly spawned enemies
+
+    Pcg32 rng;
+};
+
+static_assert(std::is_trivially_copyable_v<SimState>,
+    "SimState must stay memcpy-able: no SFML drawables, containers or pointers in it");
+
+// ============================================================================
+//  RollbackBuffer — ring of the last N ticks: the state *before* each tick
+//  plus the input that tick consumed. Rolling back k ticks = restore the
+//  saved state and re-step with the (corrected) inputs.
+// ============================================================================
+class RollbackBuffer {
+public:
+    explicit RollbackBuffer(std::size_t capacity);
+
+    // Record the state about to be stepped with `input`
+    void push(const SimState& before, const PlayerInput& input);
+
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_slots.size(); }
+
+    // Tick number of the oldest / newest frame held (valid when size() > 0)
+    std::uint64_t oldestTick() const;
+    std::uint64_t newestTick() const;
+
+    // Frame saved for `tick`, or nullptr if it has left the ring
+    const SimState*    stateAt(std::uint64_t tick) const;
+    PlayerInput*       inputAt(std::uint64_t tick);
+    const PlayerInput* inputAt(std::uint64_t tick) const;
+
+    // Forget frames newer than `tick` (after a rollback re-simulates them)
+    void truncateAfter(std::uint64_t tick);
+
+private:
+    struct Slot {
+        SimState    state;
+        PlayerInput input;
+    };
+    const Slot* find(std::uint64_t tick) const;
+
+    std::vector<Slot> m_slots;
+    std::size_t       m_head{ 0 };   // next write position
+    std::size_t       m_size{ 0 };
+};
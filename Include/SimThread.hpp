@@ -0,0 +1,102 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "GameSession.hpp"
+#include "Input.hpp"
+#include "SimState.hpp"
+#include "SpscQueue.hpp"
+#include "TripleBuffer.hpp"
+#include "World.hpp"
+
+enum class GameState { Menu, Arena, Results };
+
+// Everything the render thread needs to draw one frame (plain copy)
+struct RenderFrame {
+    SimState      sim;
+    ChunkStats    chunks{};
+    GameState     state{ GameState::Menu };
+    bool          paused{ false };
+    std::uint64_t serial{ 0 };   // increments with every publish
+};
+
+// Render thread -> sim thread
+struct SimCommand {
+    enum class Type : std::uint8_t {
+        Input,        // latest PlayerInput + window size (sent every frame)
+        Start,        // Menu/Results -> fresh Arena run
+        TogglePause,
+        Pause,        // focus lost
+        Reset,        // restart the current run
+        QuickSave,
+        QuickLoad,
+    };
+    Type         type{ Type::Input };
+    PlayerInput  input{};
+    sf::Vector2u viewSize{};
+};
+
+// ============================================================================
+//  SimThread — runs the game state machine (Menu/Arena/Results) and the
+//  GameSession at a fixed rate on its own thread. Input arrives through an
+//  SPSC command queue; every tick publishes a RenderFrame into a triple
+//  buffer, so the render thread draws the newest frame without ever
+//  blocking the sim (and a slow draw never delays a tick).
+//  Kill/hit events go through a second SPSC queue instead of the frame:
+//  the render thread may skip frames, but must not miss an explosion.
+// ============================================================================
+class ScoreJournal;
+
+class SimThread {
+public:
+    SimThread(sf::Vector2u viewSize, std::shared_ptr<sf::Texture> enemyTex, int hz = 120);
+    ~SimThread();
+
+    SimThread(const SimThread&) = delete;
+    SimThread& operator=(const SimThread&) = delete;
+
+    // Scores go through the journal (durable, never waits on the DB) instead
+    // of a direct db call. Set before start(); the journal must outlive the thread.
+    void setScoreJournal(ScoreJournal* journal) { m_journal = journal; }
+
+    void start();
+    void stop();   // joins; safe to call twice
+
+    // Render thread only. False if the queue is full (command dropped).
+    bool post(const SimCommand& cmd) { return m_commands.push(cmd); }
+
+    // Render thread only: newest completed frame, never blocks
+    const RenderFrame& latest() {
+        m_frames.fetch();
+        return m_frames.readBuffer();
+    }
+
+    // Render thread only: next kill/hit event, false when drained
+    bool pollFx(FxEvent& out) { return m_fx.pop(out); }
+
+private:
+    void run();
+    void apply(const SimCommand& cmd);
+    void tick();
+    void publish();
+    void resetRun();
+    void saveScore();
+
+    GameSession m_session;
+    GameState   m_state{ GameState::Menu };
+    bool        m_paused{ false };
+    bool        m_savedThisRun{ false };   // this run's score was handed off (journal) or stored
+    ScoreJournal* m_journal{ nullptr };
+    PlayerInput m_input{};
+    float       m_dt;
+    std::uint64_t m_serial{ 0 };
+
+    SpscQueue<SimCommand, 256> m_commands;
+    TripleBuffer<RenderFrame>  m_frames;
+    SpscQueue<FxEvent, 1024>   m_fx;       // full -> events dropped (cosmetic only)
+    std::atomic<bool>          m_running{ false };
+    std::thread                m_thread;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+
+#include "Atlas.hpp"
+
+// ============================================================================
+//  SpriteBatch — collects textured quads from one atlas page into a single
+//  vertex array and draws them with one draw call (one texture bind). The
+//  array is reused frame to frame, so steady-state frames don't allocate.
+// ============================================================================
+class SpriteBatch {
+public:
+    void clear() { m_vertices.clear(); }
+
+    // Quad of `size` centred on `center`, rotated, showing `region`, tinted by `color`
+    void add(const AtlasRegion& region, sf::Vector2f center, sf::Vector2f size,
+        sf::Angle rotation = sf::Angle{}, sf::Color color = sf::Color::White);
+
+    void draw(sf::RenderTarget& target, const sf::Texture& page) const;
+
+    std::size_t quadCount() const { return m_vertices.getVertexCount() / 6; }
+
+private:
+    sf::VertexArray m_vertices{ sf::PrimitiveType::Triangles };
+};
+
+// Regions the gameplay entities draw with, looked up once after the atlas loads.
+// All of them must live on the same page so a frame needs a single bind.
+struct GameSprites {
+    const sf::Texture* page{ nullptr };
+    AtlasRegion        white{};            // tinted rectangles (player)
+    AtlasRegion        disc{};             // tinted circles (shots, enemy fallback)
+    AtlasRegion        enemy{};
+    bool               hasEnemy{ false };  // enemy.png was packed
+
+    // Returns error text (missing built-ins, regions on different pages), empty on success
+    std::string resolve(const Atlas& atlas);
+};
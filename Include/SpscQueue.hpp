@@ -0,0 +1,55 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// ============================================================================
+//  SpscQueue — bounded lock-free single-producer / single-consumer ring.
+//  push() fails (returns false) when full instead of blocking.
+// ============================================================================
+template <class T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Producer thread only
+    bool push(const T& value) {
+        T* slot = claim();
+        if (!slot) return false;
+        *slot = value;
+        commit();
+        return true;
+    }
+
+    // Producer thread only: in-place push. claim() returns the next free slot
+    // (nullptr when full); fill it, then commit() makes it visible.
+    T* claim() {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tailCache == Capacity) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);   // only re-read when it looks full
+            if (head - m_tailCache == Capacity) return nullptr;
+        }
+        return &m_slots[head & MASK];
+    }
+
+    void commit() {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer thread only
+    bool pop(T& out) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) return false;
+        out = m_slots[tail & MASK];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<std::size_t> m_head{ 0 };   // written by producer
+    std::size_t m_tailCache{ 0 };                       // producer's last view of m_tail
+    alignas(64) std::atomic<std::size_t> m_tail{ 0 };   // written by consumer
+    std::array<T, Capacity> m_slots{};
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// ============================================================================
+//  TripleBuffer — lock-free latest-value handoff between one producer and
+//  one consumer. The producer fills writeBuffer() and publish()es it; the
+//  consumer fetch()es and reads readBuffer(). Neither side ever waits: the
+//  producer always has a free slot and the consumer always has the newest
+//  complete value (intermediate values are simply skipped).
+// ============================================================================
+template <class T>
+class TripleBuffer {
+public:
+    // ---- producer side ----
+    T& writeBuffer() { return m_buffers[m_write]; }
+
+    void publish() {
+        m_write = m_middle.exchange(static_cast<std::uint8_t>(m_write | DIRTY), std::memory_order_acq_rel) & INDEX;
+    }
+
+    // ---- consumer side ----
+    // Swap in the newest published value; false if nothing new since last fetch
+    bool fetch() {
+        if (!(m_middle.load(std::memory_order_relaxed) & DIRTY)) return false;
+        m_read = m_middle.exchange(m_read, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    const T& readBuffer() const { return m_buffers[m_read]; }
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3;
+    static constexpr std::uint8_t DIRTY = 0x4;
+
+    std::array<T, 3> m_buffers;
+    alignas(64) std::atomic<std::uint8_t> m_middle{ 1 };   // slot index | DIRTY
+    alignas(64) std::uint8_t m_write{ 0 };                 // producer only
+    alignas(64) std::uint8_t m_read{ 2 };                  // consumer only
+};
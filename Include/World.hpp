@@ -0,0 +1,99 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// ============================================================================
+//  World — the arena is much larger than the window and split into square
+//  chunks. Only chunks near the player are simulated every tick:
+//    Active   (within ACTIVE_RADIUS)  full rate, collisions
+//    Coarse   (within COARSE_RADIUS)  one tick in COARSE_TICK_INTERVAL, scaled dt
+//    Sleeping (further out)           frozen until the player comes back
+//  Sleeping entities are never visited per tick (GameSession keeps them
+//  behind the awake ones and only re-sorts when the player changes chunk),
+//  and chunk bookkeeping covers just the awake window, so CPU follows the
+//  active area, not the world size or the total population.
+// ============================================================================
+namespace world {
+    constexpr float WIDTH = 16384.f;
+    constexpr float HEIGHT = 16384.f;
+    constexpr float CHUNK_SIZE = 512.f;
+    constexpr int   ACTIVE_RADIUS = 2;   // 5x5 chunks around the player (> one screen)
+    constexpr int   COARSE_RADIUS = 6;
+    constexpr int   COARSE_TICK_INTERVAL = 8;
+
+    inline sf::FloatRect bounds() {
+        return sf::FloatRect{ sf::Vector2f{ 0.f, 0.f }, sf::Vector2f{ WIDTH, HEIGHT } };
+    }
+    sf::Vector2f clampToWorld(sf::Vector2f p);
+}
+
+struct ChunkCoord {
+    int x{ 0 };
+    int y{ 0 };
+    bool operator==(const ChunkCoord&) const = default;
+};
+
+// Outside the world: "no chunk yet" (forces a re-sort on the next tick)
+inline constexpr ChunkCoord NO_CHUNK{ -0x40000000, -0x40000000 };
+
+enum class ChunkActivity : std::uint8_t { Active, Coarse, Sleeping };
+
+// Per-tick chunk metrics (reset by ChunkMap::beginTick)
+struct ChunkStats {
+    std::size_t occupied{ 0 };          // chunks holding at least one entity
+    std::size_t active{ 0 };
+    std::size_t coarse{ 0 };
+    std::size_t sleeping{ 0 };
+    std::size_t simulatedEntities{ 0 }; // entities that actually ticked this tick
+    std::size_t sleepingEntities{ 0 };
+
+    bool operator==(const ChunkStats&) const = default;
+};
+
+// What an entity at a given position does this tick
+struct ChunkTick {
+    ChunkActivity activity{ ChunkActivity::Active };
+    int           dtScale{ 1 };   // 0 = skip this tick
+};
+
+ChunkCoord chunkOf(sf::Vector2f p);
+
+// Activity of chunk c while the player is in chunk `center` (Chebyshev rings)
+ChunkActivity activityAt(ChunkCoord c, ChunkCoord center);
+
+// World-space rect covered by the active chunks around `center`
+sf::FloatRect activeRegion(ChunkCoord center);
+
+class ChunkMap {
+public:
+    // Start a tick around the player's chunk; clears last tick's counts
+    void beginTick(ChunkCoord playerChunk, std::uint64_t tick);
+
+    // Record an awake entity at p and get its update schedule for this tick.
+    // Outside the coarse window it counts as sleeping (frozen until re-sorted).
+    ChunkTick touch(sf::Vector2f p);
+
+    // Sleeping population, counted by the caller only when it changes
+    void setSleepers(std::size_t chunks, std::size_t entities);
+
+    ChunkActivity activityOf(ChunkCoord c) const { return activityAt(c, m_center); }
+    const ChunkStats& stats() const { return m_stats; }
+
+private:
+    static constexpr int WINDOW = 2 * world::COARSE_RADIUS + 1;   // awake chunks per side
+
+    ChunkCoord    m_center{};
+    std::uint64_t m_tick{ 0 };
+    ChunkStats    m_stats{};
+    std::size_t   m_sleepingChunks{ 0 };
+    std::size_t   m_sleepingEntities{ 0 };
+
+    // Window chunk already counted this tick <=> m_seen[i] == m_stamp (no clearing, no hashing)
+    std::uint32_t                                m_stamp{ 0 };
+    std::array<std::uint32_t, WINDOW * WINDOW>   m_seen{};
+};
+
+// Faint chunk lines for the part of the world inside `view` (motion reference)
+void drawChunkGrid(sf::RenderTarget& target, const sf::View& view);
@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================================================
+//  WorldSerializer — compact binary world state for save/load, crash dumps
+//  and wire snapshots.
+//
+//  Layout (version 1, little-endian):
+//    "AFWS" | u8 version | u8 flags (reserved, 0)
+//    varint zigzag(score) | varint lives | varint enemyCount | varint shotCount
+//    bit stream (LSB first, zero-padded to a byte):
+//      player { x16 y16 rot16 }
+//      enemy  { x16 y16 vx16 vy16 speed12 radius8 alive1 } * enemyCount
+//      shot   { x16 y16 vx16 vy16 alive1 } * shotCount
+//  Positions are quantized to 1/4 px over the world, velocities to 1/16 px/s.
+//  Decoding reads straight from the caller's buffer (e.g. a mapped file) and
+//  reuses the output vectors' capacity, so there is no per-entity allocation.
+// ============================================================================
+
+struct EnemyRecord {
+    sf::Vector2f position{};
+    sf::Vector2f velocity{};
+    float        speed{ 0.f };
+    float        radius{ 0.f };
+    bool         alive{ true };
+};
+
+struct ShotRecord {
+    sf::Vector2f position{};
+    sf::Vector2f velocity{};
+    bool         alive{ true };
+};
+
+// Plain copy of the serializable parts of a GameSession
+struct WorldSnapshot {
+    int          score{ 0 };
+    int          lives{ 0 };
+    sf::Vector2f playerPosition{};
+    float        playerRotationDeg{ 0.f };
+    std::vector<EnemyRecord> enemies;
+    std::vector<ShotRecord>  shots;
+};
+
+namespace serial {
+
+    constexpr std::uint8_t FORMAT_VERSION = 1;
+
+    // Quantization steps (worst-case round-trip error is half a step)
+    constexpr float POS_STEP = 0.25f;         // px
+    constexpr float VEL_STEP = 1.f / 16.f;    // px/s
+    constexpr float SPEED_STEP = 0.25f;       // px/s, 12 bits -> up to ~1024
+    constexpr float RADIUS_STEP = 0.25f;      // px, 8 bits -> up to ~64
+    constexpr float ROT_STEP = 360.f / 65536.f;
+
+    // Appends the encoded snapshot to `out` (cleared first)
+    void encode(const WorldSnapshot& world, std::vector<std::uint8_t>& out);
+
+    // Decodes `size` bytes at `data` into `out`.
+    // Returns empty string on success, or an error message.
+    std::string decode(const std::uint8_t* data, std::size_t size, WorldSnapshot& out);
+
+    // Upper bound of encode() output, for sizing mapped files / send buffers
+    std::size_t maxEncodedSize(std::size_t enemyCount, std::size_t shotCount);
+}
@@ -0,0 +1,16 @@
+#include "Input.hpp"
+
+PlayerInput pollLocalInput(const sf::RenderWindow& window) {
+    PlayerInput in;
+
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) in.move.x -= 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) in.move.x += 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) in.move.y -= 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S)) in.move.y += 1.f;
+
+    in.aim = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    in.fire = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) ||
+        sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+    return in;
+}
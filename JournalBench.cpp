@@ -0,0 +1,121 @@
+// ============================================================================
+//  JournalBench.cpp — ScoreJournal submit cost + crash/replay check
+//  Usage: AlienForceJournalBench [--bursts B] [--burst N] [--file path]
+//  1. DB "down" (sink always fails): B bursts of N submits from one thread.
+//     Reports ns per submit() on the calling thread and how long until the
+//     whole burst was durable (group commit: one fsync per burst, not per score).
+//  2. Appends a torn half-frame, as if the process died mid-write.
+//  3. Reopens with a working sink: every score must be replayed exactly once,
+//     in id order, and the file compacted to the header plus one ack.
+//     Exits non-zero otherwise.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Log.hpp"
+#include "ScoreJournal.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct JournalBenchOptions {
+    int         bursts = 50;
+    int         burst = 64;
+    std::string file = "journalbench.afsj";
+};
+
+static JournalBenchOptions parseArgs(int argc, char** argv) {
+    JournalBenchOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--bursts")     o.bursts = std::max(1, std::atoi(v));
+        else if (k == "--burst") o.burst = std::max(1, std::atoi(v));
+        else if (k == "--file")  o.file = v;
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+int main(int argc, char** argv) {
+    const JournalBenchOptions opt = parseArgs(argc, argv);
+    const std::uint64_t total = static_cast<std::uint64_t>(opt.bursts) * static_cast<std::uint64_t>(opt.burst);
+    std::cout << "[BENCH] " << opt.bursts << " bursts x " << opt.burst << " scores -> " << opt.file << "\n";
+
+    logging::start((opt.file + ".log").c_str());
+    std::error_code ec;
+    std::filesystem::remove(opt.file, ec);
+
+    // ---- 1. Submit while the database is unreachable ----
+    std::vector<double> submitNs, durableUs;
+    {
+        ScoreJournal journal(opt.file, [](const std::vector<ScoreSubmission>&) { return std::string("db down"); });
+        if (auto err = journal.open(); !err.empty()) {
+            std::cout << "[BENCH] " << err << "\n";
+            return 1;
+        }
+        for (int b = 0; b < opt.bursts; ++b) {
+            const auto t0 = Clock::now();
+            std::uint64_t last = 0;
+            for (int i = 0; i < opt.burst; ++i) last = journal.submit("Bench", b * opt.burst + i, "bench");
+            const auto t1 = Clock::now();
+            while (journal.durableId() < last) std::this_thread::yield();
+            const auto t2 = Clock::now();
+            submitNs.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / opt.burst);
+            durableUs.push_back(std::chrono::duration<double, std::micro>(t2 - t0).count());
+        }
+        journal.stop();
+    }
+
+    // ---- 2. Crash mid-write: half a frame at the end ----
+    const std::uintmax_t sizeBefore = std::filesystem::file_size(opt.file, ec);
+    {
+        std::ofstream torn(opt.file, std::ios::binary | std::ios::app);
+        const char junk[] = { 0x30, 0x00, 0x00, 0x00, 0x12, 0x34 };
+        torn.write(junk, sizeof(junk));
+    }
+
+    // ---- 3. Restart with the database back: replay ----
+    std::vector<ScoreSubmission> stored;
+    {
+        ScoreJournal journal(opt.file, [&stored](const std::vector<ScoreSubmission>& rows) {
+            stored.insert(stored.end(), rows.begin(), rows.end());
+            return std::string();
+            }, JournalOptions{ std::chrono::milliseconds(2), std::chrono::milliseconds(5000), 256, 0 });
+        if (auto err = journal.open(); !err.empty()) {
+            std::cout << "[BENCH] reopen: " << err << "\n";
+            return 1;
+        }
+        const auto deadline = Clock::now() + std::chrono::seconds(10);
+        while (journal.ackedId() < total && Clock::now() < deadline) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        journal.stop();
+    }
+    const std::uintmax_t sizeAfter = std::filesystem::file_size(opt.file, ec);
+    logging::stop();
+
+    bool ok = stored.size() == total;
+    for (std::size_t i = 0; ok && i < stored.size(); ++i) {
+        ok = stored[i].id == i + 1 && stored[i].score == static_cast<int>(i) && stored[i].player == "Bench";
+    }
+    // Everything acked and compactBytes 0: the file must be down to
+    // "AFSJ" + version and one Ack frame (length, crc, kind, id)
+    constexpr std::uintmax_t COMPACTED_SIZE = 4 + 4 + (4 + 4 + 1 + 8);
+    const bool compacted = sizeAfter == COMPACTED_SIZE && sizeAfter < sizeBefore;
+
+    std::cout << "[BENCH] submit ns/score   p50 " << bench::percentile(submitNs, 0.50) << "  p99 " << bench::percentile(submitNs, 0.99)
+        << "  max " << bench::percentile(submitNs, 1.00) << "\n";
+    std::cout << "[BENCH] burst durable us  p50 " << bench::percentile(durableUs, 0.50) << "  p99 " << bench::percentile(durableUs, 0.99)
+        << "  max " << bench::percentile(durableUs, 1.00) << "\n";
+    std::cout << "[BENCH] journal " << sizeBefore << " bytes before replay, " << sizeAfter << " after compaction ("
+        << (compacted ? "OK" : "expected " + std::to_string(COMPACTED_SIZE)) << ")\n";
+    std::cout << "[BENCH] replay: " << stored.size() << " / " << total << " scores " << (ok ? "OK" : "MISMATCH") << "\n";
+    return (ok && compacted) ? 0 : 1;
+}
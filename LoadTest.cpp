@@ -0,0 +1,133 @@
+// ============================================================================
+//  LoadTest.cpp — headless load test: N Bot-driven GameSessions in-process
+//  Usage: AlienForceLoadTest [--bots N] [--seconds S] [--hz H] [--seed X]
+//  Reports per-session tick latency and aggregate throughput vs frame budget.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Bot.hpp"
+#include "GameSession.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct LoadTestOptions {
+    int           bots = 2000;
+    float         seconds = 30.f;   // simulated time per session
+    int           hz = 120;
+    std::uint32_t seed = 1;
+};
+
+static LoadTestOptions parseArgs(int argc, char** argv) {
+    LoadTestOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--bots")         o.bots = std::max(1, std::atoi(v));
+        else if (k == "--seconds") o.seconds = static_cast<float>(std::atof(v));
+        else if (k == "--hz")      o.hz = std::max(1, std::atoi(v));
+        else if (k == "--seed")    o.seed = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+int main(int argc, char** argv) {
+    const LoadTestOptions opt = parseArgs(argc, argv);
+    const float dt = 1.f / static_cast<float>(opt.hz);
+    const int   ticks = std::max(1, static_cast<int>(opt.seconds * opt.hz));
+
+    std::vector<GameSession> sessions;
+    std::vector<Bot>         bots;
+    sessions.reserve(opt.bots);
+    bots.reserve(opt.bots);
+    for (int i = 0; i < opt.bots; ++i) {
+        sessions.emplace_back(sf::Vector2u{ 960u, 540u }, nullptr, opt.seed + static_cast<std::uint32_t>(i));
+        bots.emplace_back(opt.seed * 7919u + static_cast<std::uint32_t>(i));
+    }
+
+    std::cout << "[LOAD] " << opt.bots << " sessions x " << ticks << " ticks @ " << opt.hz << " Hz\n";
+
+    // Per-session step latency (sampled) and whole-tick cost across all sessions
+    std::vector<std::int64_t> sessionNs;
+    std::vector<std::int64_t> tickNs;
+    sessionNs.reserve(static_cast<std::size_t>(ticks) * std::min(opt.bots, 64));
+    tickNs.reserve(ticks);
+
+    std::int64_t runsFinished = 0;
+    std::int64_t scoreSum = 0;
+    std::int64_t maxEntities = 0;
+    std::int64_t activeChunkSum = 0, occupiedChunkSum = 0, maxActiveChunks = 0;
+    std::int64_t simulatedSum = 0, sleepingSum = 0;
+
+    const auto wallStart = Clock::now();
+    for (int t = 0; t < ticks; ++t) {
+        const auto tickStart = Clock::now();
+        std::int64_t entities = 0;
+
+        for (int i = 0; i < opt.bots; ++i) {
+            GameSession& s = sessions[i];
+            const bool sample = i < 64;   // timing every session would skew the results
+            const auto t0 = sample ? Clock::now() : Clock::time_point{};
+
+            s.step(dt, bots[i].think(s, dt));
+
+            if (sample) {
+                sessionNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count());
+            }
+            entities += static_cast<std::int64_t>(s.enemies().size() + s.shots().size());
+
+            const ChunkStats& cs = s.chunkStats();
+            activeChunkSum += static_cast<std::int64_t>(cs.active);
+            occupiedChunkSum += static_cast<std::int64_t>(cs.occupied);
+            maxActiveChunks = std::max(maxActiveChunks, static_cast<std::int64_t>(cs.active));
+            simulatedSum += static_cast<std::int64_t>(cs.simulatedEntities);
+            sleepingSum += static_cast<std::int64_t>(cs.sleepingEntities);
+
+            if (s.isGameOver()) {
+                ++runsFinished;
+                scoreSum += s.score();
+                s.reset();
+            }
+        }
+
+        tickNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tickStart).count());
+        maxEntities = std::max(maxEntities, entities);
+    }
+    const double wallSec = std::chrono::duration<double>(Clock::now() - wallStart).count();
+
+    const double sessionTicks = static_cast<double>(opt.bots) * ticks;
+    const double budgetUs = 1e6 / opt.hz;
+    const double tickP50 = bench::percentileUs(tickNs, 0.50);
+    const double tickP99 = bench::percentileUs(tickNs, 0.99);
+    const double tickMax = bench::percentileUs(tickNs, 1.00);
+
+    std::cout << "[LOAD] wall " << wallSec << " s, simulated " << ticks * dt << " s ("
+        << (ticks * dt) / wallSec << "x realtime)\n";
+    std::cout << "[LOAD] throughput " << sessionTicks / wallSec << " session-ticks/s\n";
+    std::cout << "[LOAD] session step us  p50 " << bench::percentileUs(sessionNs, 0.50)
+        << "  p90 " << bench::percentileUs(sessionNs, 0.90)
+        << "  p99 " << bench::percentileUs(sessionNs, 0.99)
+        << "  max " << bench::percentileUs(sessionNs, 1.00) << "\n";
+    std::cout << "[LOAD] full tick us     p50 " << tickP50 << "  p99 " << tickP99
+        << "  max " << tickMax << "  (budget " << budgetUs << ")\n";
+    std::cout << "[LOAD] est. sessions per core @ " << opt.hz << " Hz: "
+        << static_cast<std::int64_t>(opt.bots * budgetUs / std::max(tickP99, 1e-3)) << " (p99)\n";
+    std::cout << "[LOAD] runs finished " << runsFinished
+        << ", mean score " << (runsFinished ? static_cast<double>(scoreSum) / runsFinished : 0.0)
+        << ", peak live entities " << maxEntities << "\n";
+    std::cout << "[LOAD] chunks/session  active mean " << activeChunkSum / sessionTicks
+        << "  peak " << maxActiveChunks
+        << "  occupied mean " << occupiedChunkSum / sessionTicks
+        << "  |  enemies simulated/tick " << simulatedSum / sessionTicks
+        << "  sleeping " << sleepingSum / sessionTicks << "\n";
+
+    // Non-zero exit when the p99 tick blows the frame budget, so CI can gate on it
+    return tickP99 <= budgetUs ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+#define _CRT_SECURE_NO_WARNINGS   // fopen / vsnprintf on MSVC
+#include "Log.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SpscQueue.hpp"
+
+// ============================================================================
+// ======================= Records & per-thread rings =========================
+// ============================================================================
+using LogClock = std::chrono::steady_clock;
+using logging::detail::Record;
+
+static constexpr std::size_t RING_CAPACITY = 1024;   // records per thread
+
+struct ThreadRing {
+    SpscQueue<Record, RING_CAPACITY>    ring;        // producer: owning thread, consumer: drain
+    std::atomic<std::uint64_t>          dropped{ 0 };
+    std::atomic<bool>                   inUse{ true };   // false once the owning thread exited
+    std::uint64_t                       reportedDrops{ 0 };   // drain thread only
+    std::uint16_t                       id{ 0 };
+};
+
+struct DropReport {
+    std::uint16_t thread;
+    std::uint64_t count;
+};
+
+struct Logger {
+    std::mutex                               registryMutex;   // ring registration + drain pass
+    std::vector<std::unique_ptr<ThreadRing>> rings;           // never shrinks; freed rings are reused
+    const LogClock::time_point               epoch = LogClock::now();
+
+    std::thread       drainThread;
+    std::atomic<bool> running{ false };
+    std::FILE*        out{ nullptr };
+    bool              ownsFile{ false };
+    std::vector<Record>     batch;                            // drain thread only
+    std::vector<DropReport> drops;                            // drain thread only
+
+    ~Logger();
+};
+
+static Logger& logger() {
+    static Logger instance;
+    return instance;
+}
+
+// A thread takes a ring on its first log call and hands it back when it
+// exits, so short-lived threads reuse rings instead of each leaving one
+// behind. Records still queued in a freed ring are drained as usual; the next
+// owner just appends after them (one producer at a time, handed over through
+// the release/acquire on inUse). A reused ring keeps its [T<n>] tag.
+struct RingLease {
+    ThreadRing* ring;
+
+    RingLease() {
+        Logger& lg = logger();
+        std::lock_guard<std::mutex> lock(lg.registryMutex);
+        for (auto& r : lg.rings) {
+            if (!r->inUse.load(std::memory_order_acquire)) {
+                r->inUse.store(true, std::memory_order_relaxed);
+                ring = r.get();
+                return;
+            }
+        }
+        auto fresh = std::make_unique<ThreadRing>();
+        fresh->id = static_cast<std::uint16_t>(lg.rings.size());
+        lg.rings.push_back(std::move(fresh));
+        ring = lg.rings.back().get();
+    }
+    ~RingLease() { ring->inUse.store(false, std::memory_order_release); }
+};
+
+static ThreadRing& threadRing() {
+    thread_local RingLease lease;
+    return *lease.ring;
+}
+// ============================================================================
+
+
+// ============================================================================
+// ================================ Drain =====================================
+// ============================================================================
+static const char* levelName(LogLevel level) {
+    switch (level) {
+    case LogLevel::Debug: return "DEBUG";
+    case LogLevel::Info:  return "INFO";
+    case LogLevel::Warn:  return "WARN";
+    case LogLevel::Error: return "ERROR";
+    }
+    return "?";
+}
+
+// One pass over every ring; returns the number of records written
+static std::size_t drainOnce(Logger& lg) {
+    lg.batch.clear();
+    lg.drops.clear();
+    {
+        std::lock_guard<std::mutex> lock(lg.registryMutex);
+        Record rec;
+        for (auto& r : lg.rings) {
+            while (r->ring.pop(rec)) lg.batch.push_back(rec);
+            const std::uint64_t dropped = r->dropped.load(std::memory_order_relaxed);
+            if (dropped != r->reportedDrops) {
+                lg.drops.push_back(DropReport{ r->id, dropped - r->reportedDrops });
+                r->reportedDrops = dropped;
+            }
+        }
+    }
+    if (lg.batch.empty() && lg.drops.empty()) return 0;
+
+    // Rings are per thread: merge them back into time order
+    std::stable_sort(lg.batch.begin(), lg.batch.end(),
+        [](const Record& a, const Record& b) { return a.ns < b.ns; });
+
+    // Formatting happens here, off the logging threads
+    char text[512];
+    for (const Record& rec : lg.batch) {
+        rec.format(rec.args, rec.fmt, text, sizeof(text));
+        std::fprintf(lg.out, "[%10.3f] [T%u] [%s] [%s] %s\n",
+            static_cast<double>(rec.ns) * 1e-9, static_cast<unsigned>(rec.thread),
+            levelName(rec.level), rec.tag, text);
+    }
+    // Same line format as a record, stamped now, tagged with the thread whose ring overflowed
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(LogClock::now() - lg.epoch).count();
+    for (const DropReport& d : lg.drops) {
+        std::fprintf(lg.out, "[%10.3f] [T%u] [%s] [LOG] %llu records dropped (ring full)\n",
+            static_cast<double>(now) * 1e-9, static_cast<unsigned>(d.thread),
+            levelName(LogLevel::Warn), static_cast<unsigned long long>(d.count));
+    }
+    std::fflush(lg.out);
+    return lg.batch.size();
+}
+
+static void drainLoop(Logger& lg) {
+    while (lg.running.load(std::memory_order_acquire)) {
+        if (drainOnce(lg) == 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    drainOnce(lg);   // whatever was queued before stop()
+}
+
+static void stopLogger(Logger& lg) {
+    lg.running.store(false, std::memory_order_release);
+    if (lg.drainThread.joinable()) lg.drainThread.join();
+    if (lg.ownsFile && lg.out) std::fclose(lg.out);
+    lg.out = nullptr;
+    lg.ownsFile = false;
+}
+
+Logger::~Logger() {
+    stopLogger(*this);   // flush on normal exit even if stop() was never called
+}
+// ============================================================================
+
+
+namespace logging {
+
+    std::string start(const char* path) {
+        Logger& lg = logger();
+        if (lg.running.load()) return "logger already running";
+
+        if (path) {
+            lg.out = std::fopen(path, "a");
+            if (!lg.out) return std::string("cannot open log file: ") + path;
+            lg.ownsFile = true;
+        }
+        else {
+            lg.out = stdout;
+            lg.ownsFile = false;
+        }
+        lg.batch.reserve(RING_CAPACITY);
+        lg.running.store(true, std::memory_order_release);
+        lg.drainThread = std::thread(drainLoop, std::ref(lg));
+        return {};
+    }
+
+    void stop() {
+        stopLogger(logger());
+    }
+
+    std::uint64_t dropped() {
+        Logger& lg = logger();
+        std::lock_guard<std::mutex> lock(lg.registryMutex);
+        std::uint64_t n = 0;
+        for (auto& r : lg.rings) n += r->dropped.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    namespace detail {
+
+        Record* claim() {
+            ThreadRing& tr = threadRing();
+            Record* rec = tr.ring.claim();
+            if (!rec) {
+                tr.dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            rec->thread = tr.id;
+            return rec;
+        }
+
+        void commit(Record& rec) {
+            rec.ns = std::chrono::duration_cast<std::chrono::nanoseconds>(LogClock::now() - logger().epoch).count();
+            threadRing().ring.commit();
+        }
+
+    } // namespace detail
+
+} // namespace logging
@@ -0,0 +1,119 @@
+// ============================================================================
+//  LogBench.cpp — cost of a log call on the calling (game) thread
+//  Usage: AlienForceLogBench [--threads T] [--bursts B] [--burst N] [--out file]
+//  Each thread logs bursts of N records (under the ring capacity) and idles
+//  briefly between bursts so the drain thread keeps up, the way a game
+//  thread logs a few lines per frame. Reports ns per call for:
+//    - AF_LOG_INFO (formatted, pushed to the ring),
+//    - AF_LOG_DEBUG (compiled out at the default ALIENFORCE_LOG_MIN_LEVEL),
+//    - a synchronous fprintf + fflush to the same kind of sink, for reference.
+// ============================================================================
+
+#define _CRT_SECURE_NO_WARNINGS   // fopen on MSVC
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Log.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct LogBenchOptions {
+    int         threads = 2;
+    int         bursts = 2000;
+    int         burst = 256;
+    std::string out = "logbench.log";
+};
+
+static LogBenchOptions parseArgs(int argc, char** argv) {
+    LogBenchOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--threads")     o.threads = std::max(1, std::atoi(v));
+        else if (k == "--bursts") o.bursts = std::max(1, std::atoi(v));
+        else if (k == "--burst")  o.burst = std::max(1, std::atoi(v));
+        else if (k == "--out")    o.out = v;
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+// Runs `body(i)` burst-by-burst on `threads` threads; returns per-call ns of every burst
+template <class Body>
+static std::vector<double> timeBursts(const LogBenchOptions& opt, Body body) {
+    std::vector<std::vector<double>> perThread(opt.threads);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < opt.threads; ++t) {
+        pool.emplace_back([&, t] {
+            auto& samples = perThread[t];
+            samples.reserve(opt.bursts);
+            for (int b = 0; b < opt.bursts; ++b) {
+                const auto t0 = Clock::now();
+                for (int i = 0; i < opt.burst; ++i) body(b * opt.burst + i);
+                const auto ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+                samples.push_back(ns / opt.burst);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));   // "rest of the frame"
+            }
+            });
+    }
+    for (auto& th : pool) th.join();
+
+    std::vector<double> all;
+    for (auto& s : perThread) all.insert(all.end(), s.begin(), s.end());
+    return all;
+}
+
+static void report(const char* name, std::vector<double> perCall) {
+    std::cout << "[BENCH] " << name << " ns/call  p50 " << bench::percentile(perCall, 0.50)
+        << "  p99 " << bench::percentile(perCall, 0.99) << "  max " << bench::percentile(perCall, 1.00) << "\n";
+}
+
+int main(int argc, char** argv) {
+    const LogBenchOptions opt = parseArgs(argc, argv);
+    std::cout << "[BENCH] " << opt.threads << " threads x " << opt.bursts << " bursts x "
+        << opt.burst << " records -> " << opt.out << "\n";
+
+    if (auto err = logging::start(opt.out.c_str()); !err.empty()) {
+        std::cout << "[BENCH] " << err << "\n";
+        return 1;
+    }
+
+    // Warm up: registers each thread's ring, faults in its pages
+    timeBursts(LogBenchOptions{ opt.threads, 4, opt.burst, opt.out }, [](int i) {
+        AF_LOG_INFO("BENCH", "warm-up %d", i);
+        });
+
+    const auto asyncNs = timeBursts(opt, [](int i) {
+        AF_LOG_INFO("BENCH", "tick %d enemies %d score %d dt %.4f", i, i & 1023, i * 10, 1.0 / 120.0);
+        });
+    const auto filteredNs = timeBursts(opt, [](int i) {
+        AF_LOG_DEBUG("BENCH", "tick %d enemies %d score %d dt %.4f", i, i & 1023, i * 10, 1.0 / 120.0);
+        });
+    logging::stop();
+    const std::uint64_t dropped = logging::dropped();
+
+    // Reference: the calling thread formats and writes itself (what std::cout did)
+    std::FILE* sync = std::fopen((opt.out + ".sync").c_str(), "w");
+    if (!sync) {
+        std::cout << "[BENCH] cannot open " << opt.out << ".sync\n";
+        return 1;
+    }
+    const auto syncNs = timeBursts(opt, [sync](int i) {
+        std::fprintf(sync, "[INFO] [BENCH] tick %d enemies %d score %d dt %.4f\n", i, i & 1023, i * 10, 1.0 / 120.0);
+        std::fflush(sync);
+        });
+    std::fclose(sync);
+
+    report("async AF_LOG_INFO   ", asyncNs);
+    report("filtered AF_LOG_DEBUG", filteredNs);
+    report("sync fprintf+fflush ", syncNs);
+    std::cout << "[BENCH] dropped records: " << dropped << "\n";
+    return dropped == 0 ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// ============================================================================
+//  ParticleBench.cpp — per-frame CPU cost of the particle pool under kill spikes
+//  Usage: AlienForceParticleBench [--frames F] [--kills K] [--spike-every S]
+//                                 [--capacity C] [--spawn-per-frame P] [--max-p99-us U]
+//  Runs F frames at 120 Hz. Every frame a few enemies die; every S-th frame
+//  K die at once (a screen-clearing bomb). Reports emit + update time and
+//  vertex-building time (draw() minus the GPU call) per frame, and the pool
+//  high-water mark, which the budget keeps bounded however large K gets.
+//  Exit code is non-zero if a frame spawns more than the budget allows,
+//  spawns less than it could, miscounts the budget drops, or (with U > 0)
+//  the p99 of emit + update + vertices exceeds U microseconds.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Particles.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct ParticleBenchOptions {
+    int            frames = 6000;
+    int            kills = 5000;
+    int            spikeEvery = 240;
+    double         maxP99Us = 0.0;   // 0: report only
+    ParticleBudget budget{};
+};
+
+static ParticleBenchOptions parseArgs(int argc, char** argv) {
+    ParticleBenchOptions o;
+    bench::parseOptions(argc, argv, [&o](std::string_view k, const char* v) {
+        if (k == "--frames")               o.frames = std::max(1, std::atoi(v));
+        else if (k == "--kills")           o.kills = std::max(0, std::atoi(v));
+        else if (k == "--spike-every")     o.spikeEvery = std::max(1, std::atoi(v));
+        else if (k == "--capacity")        o.budget.capacity = static_cast<std::size_t>(std::max(1, std::atoi(v)));
+        else if (k == "--spawn-per-frame") o.budget.spawnPerFrame = static_cast<std::size_t>(std::max(0, std::atoi(v)));
+        else if (k == "--max-p99-us")      o.maxP99Us = std::max(0.0, std::atof(v));
+        else return false;
+        return true;
+        });
+    return o;
+}
+
+int main(int argc, char** argv) {
+    const ParticleBenchOptions opt = parseArgs(argc, argv);
+    std::cout << "[BENCH] " << opt.frames << " frames, " << opt.kills << " kills every "
+        << opt.spikeEvery << " frames, capacity " << opt.budget.capacity
+        << ", spawn/frame " << opt.budget.spawnPerFrame << "\n";
+
+    ParticleSystem particles(opt.budget);
+    std::vector<ParticleBurst> bursts;
+    bursts.reserve(static_cast<std::size_t>(opt.kills) + 8);
+    Pcg32 rng;
+
+    std::vector<double> frameUs, spikeUs, vertexUs, totalUs;
+    frameUs.reserve(opt.frames);
+    vertexUs.reserve(opt.frames);
+    totalUs.reserve(opt.frames);
+    std::size_t highWater = 0;
+    int badFrames = 0;
+    constexpr float dt = 1.f / 120.f;
+
+    for (int f = 0; f < opt.frames; ++f) {
+        const bool spike = f % opt.spikeEvery == opt.spikeEvery - 1;
+        const int kills = spike ? opt.kills : static_cast<int>(rng.below(4));
+        bursts.clear();
+        for (int k = 0; k < kills; ++k) {
+            bursts.push_back(ParticleBurst{ { rng.uniform(0.f, 4000.f), rng.uniform(0.f, 4000.f) },
+                sf::Color(255, 170, 70), 24, 220.f, 0.6f, 5.f });
+        }
+
+        std::uint64_t requested = 0;
+        for (const ParticleBurst& b : bursts) requested += b.count;
+        const std::size_t before = particles.size();
+        const std::uint64_t droppedBefore = particles.dropped();
+
+        const auto t0 = Clock::now();
+        particles.emit(bursts);
+        const std::size_t spawned = particles.size() - before;   // sampled outside the timed update
+        particles.update(dt);
+        const auto t1 = Clock::now();
+        particles.buildVertices(nullptr);
+        const auto t2 = Clock::now();
+
+        const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        frameUs.push_back(us);
+        vertexUs.push_back(std::chrono::duration<double, std::micro>(t2 - t1).count());
+        totalUs.push_back(std::chrono::duration<double, std::micro>(t2 - t0).count());
+        if (spike) spikeUs.push_back(us);
+        highWater = std::max(highWater, particles.size());
+
+        // Budget: exactly min(requested, room) spawned, the rest counted as dropped
+        const std::uint64_t room = std::min(opt.budget.spawnPerFrame, opt.budget.capacity - before);
+        const bool ok = spawned == std::min(requested, room)
+            && particles.dropped() - droppedBefore == requested - spawned
+            && particles.vertices().getVertexCount() == particles.size() * 6;
+        if (!ok && badFrames++ == 0) {
+            std::cout << "[BENCH] frame " << f << ": requested " << requested << ", room " << room
+                << ", spawned " << spawned << ", dropped " << particles.dropped() - droppedBefore << "\n";
+        }
+    }
+
+    std::cout << "[BENCH] emit+update us/frame  p50 " << bench::percentile(frameUs, 0.50)
+        << "  p99 " << bench::percentile(frameUs, 0.99) << "  max " << bench::percentile(frameUs, 1.00) << "\n";
+    std::cout << "[BENCH] vertices us/frame     p50 " << bench::percentile(vertexUs, 0.50)
+        << "  p99 " << bench::percentile(vertexUs, 0.99) << "  max " << bench::percentile(vertexUs, 1.00) << "\n";
+    std::cout << "[BENCH] spike frames us       p50 " << bench::percentile(spikeUs, 0.50)
+        << "  max " << bench::percentile(spikeUs, 1.00) << "\n";
+    std::cout << "[BENCH] live particles high-water " << highWater << " / " << opt.budget.capacity
+        << ", over budget " << particles.dropped() << "\n";
+
+    const double p99 = bench::percentile(totalUs, 0.99);
+    const bool slow = opt.maxP99Us > 0.0 && p99 > opt.maxP99Us;
+    std::cout << "[BENCH] budget accounting " << (badFrames ? "WRONG" : "OK") << " (" << badFrames << " bad frames)"
+        << ", frame p99 " << p99 << " us" << (slow ? " OVER LIMIT" : "") << "\n";
+    return (badFrames == 0 && !slow) ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+#include "Particles.hpp"
+#include <algorithm>
+#include <cmath>
+
+static constexpr float PARTICLE_DRAG = 3.0f;   // 1/s, exponential velocity falloff
+static constexpr float TWO_PI = 6.28318530718f;
+
+ParticleSystem::ParticleSystem(ParticleBudget budget) {
+    setBudget(budget);
+}
+
+void ParticleSystem::setBudget(ParticleBudget budget) {
+    m_budget = budget;
+    const std::size_t n = budget.capacity;
+    for (auto* v : { &m_px, &m_py, &m_vx, &m_vy, &m_age, &m_ageRate, &m_size }) {
+        v->assign(n, 0.f);
+    }
+    m_color.assign(n, sf::Color::Transparent);
+    m_count = 0;
+}
+
+void ParticleSystem::emit(std::span<const ParticleBurst> bursts) {
+    std::uint64_t total = 0;
+    for (const ParticleBurst& b : bursts) total += b.count;
+    if (total == 0) return;
+
+    const std::uint64_t room = std::min(m_budget.spawnPerFrame, m_budget.capacity - m_count);
+    const std::uint64_t allow = std::min(total, room);
+    m_dropped += total - allow;
+    if (allow == 0) return;
+
+    // Burst k gets floor(R_k * allow / total) - floor(R_k-1 * allow / total),
+    // R_k = requests up to and including k: proportional, and sums to exactly `allow`
+    std::uint64_t requested = 0, granted = 0;
+    for (const ParticleBurst& b : bursts) {
+        requested += b.count;
+        const std::uint64_t upTo = requested * allow / total;
+        spawn(b, static_cast<std::uint32_t>(upTo - granted));
+        granted = upTo;
+    }
+}
+
+void ParticleSystem::spawn(const ParticleBurst& b, std::uint32_t n) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+        const std::size_t i = m_count++;
+        const float angle = m_rng.uniform(0.f, TWO_PI);
+        const float speed = b.speed * m_rng.uniform(0.25f, 1.f);
+        m_px[i] = b.position.x;
+        m_py[i] = b.position.y;
+        m_vx[i] = std::cos(angle) * speed;
+        m_vy[i] = std::sin(angle) * speed;
+        m_age[i] = 0.f;
+        m_ageRate[i] = 1.f / std::max(0.01f, b.life * m_rng.uniform(0.6f, 1.f));
+        m_size[i] = b.size;
+        m_color[i] = b.color;
+    }
+}
+
+void ParticleSystem::update(float dt) {
+    const std::size_t n = m_count;
+    if (n == 0) return;
+
+    float* const px = m_px.data();
+    float* const py = m_py.data();
+    float* const vx = m_vx.data();
+    float* const vy = m_vy.data();
+    float* const age = m_age.data();
+    const float* const ageRate = m_ageRate.data();
+    const float damp = std::exp(-PARTICLE_DRAG * dt);
+
+    // Branch-free passes over contiguous floats (vectorized)
+    for (std::size_t i = 0; i < n; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        vx[i] *= damp;
+        vy[i] *= damp;
+        age[i] += ageRate[i] * dt;
+    }
+
+    // Swap-remove expired (order doesn't matter for additive-looking sparks)
+    for (std::size_t i = 0; i < m_count;) {
+        if (age[i] < 1.f) { ++i; continue; }
+        const std::size_t last = --m_count;
+        px[i] = px[last];
+        py[i] = py[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        age[i] = age[last];
+        m_ageRate[i] = m_ageRate[last];
+        m_size[i] = m_size[last];
+        m_color[i] = m_color[last];
+    }
+}
+
+void ParticleSystem::buildVertices(const GameSprites* sprites) {
+    const std::size_t n = m_count;
+    m_vertices.resize(n * 6);   // keeps its allocation: steady state doesn't allocate
+    if (n == 0) return;
+
+    float u0 = 0.f, v0 = 0.f, u1 = 0.f, v1 = 0.f;
+    if (sprites) {
+        const sf::IntRect r = sprites->disc.rect;
+        u0 = static_cast<float>(r.position.x);
+        v0 = static_cast<float>(r.position.y);
+        u1 = u0 + static_cast<float>(r.size.x);
+        v1 = v0 + static_cast<float>(r.size.y);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const float a = m_age[i];
+        const float h = m_size[i] * (1.f - 0.5f * a) * 0.5f;   // half extent
+        sf::Color c = m_color[i];
+        c.a = static_cast<std::uint8_t>(static_cast<float>(c.a) * (1.f - a));
+
+        const sf::Vector2f tl{ m_px[i] - h, m_py[i] - h };
+        const sf::Vector2f br{ m_px[i] + h, m_py[i] + h };
+        sf::Vertex* v = &m_vertices[i * 6];
+        v[0] = sf::Vertex{ tl, c, { u0, v0 } };
+        v[1] = sf::Vertex{ { br.x, tl.y }, c, { u1, v0 } };
+        v[2] = sf::Vertex{ br, c, { u1, v1 } };
+        v[3] = v[0];
+        v[4] = v[2];
+        v[5] = sf::Vertex{ { tl.x, br.y }, c, { u0, v1 } };
+    }
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target, const GameSprites* sprites) {
+    buildVertices(sprites);
+    if (m_count == 0) return;
+    target.draw(m_vertices, sprites ? sf::RenderStates(sprites->page) : sf::RenderStates::Default);
+}
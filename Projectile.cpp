@@ -1,46 +1,59 @@
 #include "Projectile.hpp"
 #include <cmath>
 
+#include "SpriteBatch.hpp"
+
 static inline sf::Vector2f normalize(sf::Vector2f v) {
     const float len = std::sqrt(v.x * v.x + v.y * v.y);
     return (len > 0.0001f) ? sf::Vector2f{ v.x / len, v.y / len } : sf::Vector2f{ 0.f, 0.f };
 }
 
 Projectile::Projectile(float speed, float radius)
-    : m_shape(radius)
-    , m_speed(speed)
+    : m_speed(speed)
     , m_radius(radius) {
-    m_shape.setOrigin(sf::Vector2f{ m_radius, m_radius });
-    m_shape.setFillColor(sf::Color(255, 220, 80));
-    m_shape.setOutlineThickness(1.f);
-    m_shape.setOutlineColor(sf::Color(255, 255, 160));
     alive = false;
 }
 
 void Projectile::fire(sf::Vector2f start, sf::Vector2f forward) {
     const sf::Vector2f dir = normalize(forward);
     m_velocity = sf::Vector2f{ dir.x * m_speed, dir.y * m_speed };
-    m_shape.setPosition(start);
-
-    const float angleRad = std::atan2(dir.y, dir.x);
-    m_shape.setRotation(sf::degrees(angleRad * 180.f / 3.14159265f));
+    m_position = start;
     alive = true;
 }
 
 void Projectile::update(float dt) {
     if (!alive) return;
-    const sf::Vector2f pos = m_shape.getPosition();
-    m_shape.setPosition(sf::Vector2f{ pos.x + m_velocity.x * dt, pos.y + m_velocity.y * dt });
+    m_position = sf::Vector2f{ m_position.x + m_velocity.x * dt, m_position.y + m_velocity.y * dt };
 }
 
 void Projectile::draw(sf::RenderTarget& target) const {
     if (!alive) return;
-    target.draw(m_shape);
+    // One shared shape for every shot; only the render side ever draws
+    static sf::CircleShape shape = [] {
+        sf::CircleShape s;
+        s.setFillColor(sf::Color(255, 220, 80));
+        s.setOutlineThickness(1.f);
+        s.setOutlineColor(sf::Color(255, 255, 160));
+        return s;
+    }();
+    if (shape.getRadius() != m_radius) {
+        shape.setRadius(m_radius);
+        shape.setOrigin(sf::Vector2f{ m_radius, m_radius });
+    }
+    shape.setPosition(m_position);
+    target.draw(shape);
+}
+
+void Projectile::draw(SpriteBatch& batch, const GameSprites& sprites) const {
+    if (!alive) return;
+    const sf::Vector2f diameter{ m_radius * 2.f, m_radius * 2.f };
+    batch.add(sprites.disc, m_position, diameter + sf::Vector2f{ 2.f, 2.f }, sf::Angle{}, sf::Color(255, 255, 160));
+    batch.add(sprites.disc, m_position, diameter, sf::Angle{}, sf::Color(255, 220, 80));
 }
 
 // SFML 3: sf::FloatRect uses .position (Vector2f) and .size (Vector2f)
 bool Projectile::outOf(const sf::FloatRect& rect) const {
-    const sf::Vector2f p = m_shape.getPosition();
+    const sf::Vector2f p = m_position;
     const sf::Vector2f rpos = rect.position;
     const sf::Vector2f rsz = rect.size;
     return !(p.x >= rpos.x &&
@@ -49,10 +62,13 @@ bool Projectile::outOf(const sf::FloatRect& rect) const {
         p.y <= rpos.y + rsz.y);
 }
 
-sf::Vector2f Projectile::getPosition() const {
-    return m_shape.getPosition();
+void Projectile::restore(sf::Vector2f position, sf::Vector2f velocity, bool isAlive) {
+    m_velocity = velocity;
+    m_position = position;
+    alive = isAlive;
 }
 
 sf::FloatRect Projectile::getBounds() const {
-    return m_shape.getGlobalBounds();
+    return sf::FloatRect{ m_position - sf::Vector2f{ m_radius, m_radius },
+                          sf::Vector2f{ m_radius * 2.f, m_radius * 2.f } };
 }
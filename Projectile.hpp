@@ -1,6 +1,10 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 
+class SpriteBatch;
+struct GameSprites;
+
+// Plain state only (trivially copyable); the circle is drawn from a shared shape.
 class Projectile {
 public:
     explicit Projectile(float speed = 600.f, float radius = 3.f);
@@ -8,18 +12,23 @@ public:
     void fire(sf::Vector2f start, sf::Vector2f forward);
     void update(float dt);
     void draw(sf::RenderTarget& target) const;
+    void draw(SpriteBatch& batch, const GameSprites& sprites) const;   // tinted disc
 
     // SFML 3 Rect API: rect.position / rect.size
     bool outOf(const sf::FloatRect& rect) const;
 
     // used by collision code
-    sf::Vector2f getPosition() const;
+    sf::Vector2f getPosition() const { return m_position; }
+    sf::Vector2f getVelocity() const { return m_velocity; }
     sf::FloatRect getBounds() const;
 
+    // Put a projectile back exactly where a saved world had it
+    void restore(sf::Vector2f position, sf::Vector2f velocity, bool isAlive);
+
     bool alive{ false };
 
 private:
-    sf::CircleShape m_shape;
+    sf::Vector2f    m_position{ 0.f, 0.f };
     sf::Vector2f    m_velocity{ 0.f, 0.f };
     float           m_speed{ 600.f };
     float           m_radius{ 3.f };
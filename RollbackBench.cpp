@@ -0,0 +1,155 @@
+// ============================================================================
+//  RollbackBench.cpp — SimState snapshot/restore cost + rollback re-simulation
+//  Usage: AlienForceRollbackBench [--ticks-back K] [--spawn-every S] [--hz H]
+//                                 [--check-budget 0|1]
+//  Warms a Bot-driven session up to a busy arena, records every tick in a
+//  RollbackBuffer, then repeatedly restores K ticks back and re-steps to the
+//  present. Reports p50/p99 against one frame at H Hz.
+//  Exit code is non-zero if the re-simulation diverges or (unless
+//  --check-budget 0, as ctest runs it) blows the budget.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "Bot.hpp"
+#include "GameSession.hpp"
+#include "SimState.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static std::int64_t nsSince(Clock::time_point t0) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+}
+
+// Every simulated field, bit for bit (not memcmp: Enemy/Projectile have
+// padding, and slots past the live counts are don't-care)
+static bool sameState(const SimState& a, const SimState& b) {
+    if (a.tick != b.tick || a.score != b.score || a.lives != b.lives
+        || a.invulnTimer != b.invulnTimer || a.hurtFlashTimer != b.hurtFlashTimer
+        || a.shootCooldown != b.shootCooldown || a.elapsed != b.elapsed
+        || a.enemySpawnAccumulator != b.enemySpawnAccumulator || a.enemySpawnEvery != b.enemySpawnEvery
+        || a.enemySpeed != b.enemySpeed || a.rng.state != b.rng.state || a.rng.inc != b.rng.inc
+        || a.enemyCount != b.enemyCount || a.shotCount != b.shotCount
+        || a.awakeCount != b.awakeCount || !(a.awakeCenter == b.awakeCenter)
+        || a.player.getPosition() != b.player.getPosition() || a.player.getRotation() != b.player.getRotation()) {
+        return false;
+    }
+    for (std::uint32_t i = 0; i < a.enemyCount; ++i) {
+        const Enemy& x = a.enemies[i];
+        const Enemy& y = b.enemies[i];
+        if (x.position() != y.position() || x.velocity() != y.velocity() || x.speed() != y.speed()
+            || x.radius() != y.radius() || x.isAlive() != y.isAlive()) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < a.shotCount; ++i) {
+        const Projectile& x = a.shots[i];
+        const Projectile& y = b.shots[i];
+        if (x.getPosition() != y.getPosition() || x.getVelocity() != y.getVelocity() || x.alive != y.alive) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int   ticksBack = 8;
+    float spawnEvery = 0.01f;   // far busier than the real game
+    int   hz = 120;
+    bool  checkBudget = true;   // timing is meaningless on a loaded CI machine
+    bench::parseOptions(argc, argv, [&](std::string_view k, const char* v) {
+        if (k == "--ticks-back")       ticksBack = std::max(1, std::atoi(v));
+        else if (k == "--spawn-every") spawnEvery = static_cast<float>(std::atof(v));
+        else if (k == "--hz")          hz = std::max(1, std::atoi(v));
+        else if (k == "--check-budget") checkBudget = std::atoi(v) != 0;
+        else return false;
+        return true;
+        });
+    const float dt = 1.f / static_cast<float>(hz);
+    const int   samples = 2000;
+
+    GameSession session(sf::Vector2u{ 960u, 540u }, nullptr, 12345u);
+    session.setSpawnInterval(spawnEvery);
+    Bot bot(777u);
+    RollbackBuffer history(static_cast<std::size_t>(ticksBack) + 1);
+
+    // Lives are topped up so the run never ends. That is an edit outside
+    // step(), so it happens before a tick is recorded, and no rollback may
+    // reach back across it (the re-simulation wouldn't repeat it).
+    SimState tmp;
+    std::uint64_t toppedUpAt = 0;
+    auto topUpLives = [&] {
+        if (session.lives() >= 2) return;
+        session.snapshot(tmp);
+        tmp.lives = GameSession::START_LIVES;
+        session.restore(tmp);
+        toppedUpAt = session.tick();
+    };
+
+    // --- Warm up to a crowded arena ---
+    for (int t = 0; t < hz * 10; ++t) {
+        topUpLives();
+        const PlayerInput in = bot.think(session, dt);
+        session.snapshot(tmp);
+        history.push(tmp, in);
+        session.step(dt, in);
+    }
+    std::cout << "[BENCH] sizeof(SimState) " << sizeof(SimState) << " bytes, "
+        << session.enemies().size() << " enemies, " << session.shots().size() << " shots live\n";
+
+    std::vector<std::int64_t> snapNs, restoreNs, rollbackNs;
+    snapNs.reserve(samples); restoreNs.reserve(samples); rollbackNs.reserve(samples);
+    int diverged = 0;
+    SimState ref, resim;
+
+    while (rollbackNs.size() < static_cast<std::size_t>(samples)) {
+        // Advance one real tick, recording it
+        topUpLives();
+        const PlayerInput in = bot.think(session, dt);
+        auto t0 = Clock::now();
+        session.snapshot(tmp);
+        snapNs.push_back(nsSince(t0));
+        history.push(tmp, in);
+        session.step(dt, in);
+
+        // Reference result for the present
+        const std::uint64_t now = session.tick();
+        const std::uint64_t from = now - static_cast<std::uint64_t>(ticksBack);
+        if (from < toppedUpAt) continue;   // would roll back across a top-up
+        session.snapshot(ref);
+
+        // Roll back K ticks and re-simulate with the recorded inputs
+        const SimState* past = history.stateAt(from);
+        if (!past) { std::cout << "[BENCH] history missing tick " << from << "\n"; return 1; }
+
+        t0 = Clock::now();
+        session.restore(*past);
+        restoreNs.push_back(nsSince(t0));
+
+        t0 = Clock::now();
+        session.restore(*past);
+        for (std::uint64_t t = from; t < now; ++t) session.step(dt, *history.inputAt(t));
+        rollbackNs.push_back(nsSince(t0));
+
+        session.snapshot(resim);
+        if (!sameState(ref, resim)) {
+            ++diverged;
+            session.restore(ref);   // carry on from the real timeline
+        }
+    }
+
+    const double budgetUs = 1e6 / hz;
+    const double rbP99 = bench::percentileUs(rollbackNs, 0.99);
+    std::cout << "[BENCH] snapshot  us  p50 " << bench::percentileUs(snapNs, 0.50) << "  p99 " << bench::percentileUs(snapNs, 0.99) << "\n";
+    std::cout << "[BENCH] restore   us  p50 " << bench::percentileUs(restoreNs, 0.50) << "  p99 " << bench::percentileUs(restoreNs, 0.99) << "\n";
+    std::cout << "[BENCH] rollback " << ticksBack << " ticks (restore + re-step) us  p50 "
+        << bench::percentileUs(rollbackNs, 0.50) << "  p99 " << rbP99
+        << "  (frame budget " << budgetUs << ", " << 100.0 * rbP99 / budgetUs << "% used)\n";
+    if (diverged) std::cout << "[BENCH] re-simulation DIVERGED in " << diverged << " of " << samples << " rollbacks\n";
+    else          std::cout << "[BENCH] re-simulation deterministic (full state, " << samples << " rollbacks)\n";
+    return (diverged == 0 && (!checkBudget || rbP99 <= budgetUs)) ? 0 : 1;
+}
@@ -0,0 +1,429 @@
+#define _CRT_SECURE_NO_WARNINGS   // fopen on MSVC
+#include "ScoreJournal.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#include <io.h>        // _commit, _fileno
+#else
+#include <unistd.h>    // fsync
+#endif
+
+#include "Log.hpp"
+
+// ============================================================================
+// ========================= Format helpers (LE, CRC32) =======================
+// ============================================================================
+static constexpr char          JOURNAL_MAGIC[4] = { 'A', 'F', 'S', 'J' };
+static constexpr std::uint32_t JOURNAL_VERSION = 1;
+static constexpr std::size_t   HEADER_SIZE = 8;
+static constexpr std::size_t   FRAME_HEADER = 8;            // length + crc
+static constexpr std::uint32_t MAX_PAYLOAD = 2 * 65536 + 64;   // two max strings + fixed fields
+
+enum class FrameKind : std::uint8_t { Submit = 1, Ack = 2 };
+
+// CRC-32 (IEEE 802.3, reflected), table built at compile time
+static constexpr std::array<std::uint32_t, 256> CRC_TABLE = [] {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t c = i;
+        for (int k = 0; k < 8; ++k) c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        t[i] = c;
+    }
+    return t;
+}();
+
+static std::uint32_t crc32(const std::uint8_t* p, std::size_t n) {
+    std::uint32_t c = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < n; ++i) c = CRC_TABLE[(c ^ p[i]) & 0xFFu] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+static void putLE(std::vector<std::uint8_t>& out, std::uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; ++i) out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+}
+
+static std::uint64_t getLE(const std::uint8_t* p, int bytes) {
+    std::uint64_t v = 0;
+    for (int i = 0; i < bytes; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    return v;
+}
+
+static void putString(std::vector<std::uint8_t>& out, const std::string& s) {
+    const std::size_t n = std::min<std::size_t>(s.size(), 0xFFFF);
+    putLE(out, n, 2);
+    out.insert(out.end(), s.begin(), s.begin() + static_cast<std::ptrdiff_t>(n));
+}
+
+// Appends one framed record; `payload` is scratch
+static void putFrame(std::vector<std::uint8_t>& out, const std::vector<std::uint8_t>& payload) {
+    putLE(out, payload.size(), 4);
+    putLE(out, crc32(payload.data(), payload.size()), 4);
+    out.insert(out.end(), payload.begin(), payload.end());
+}
+
+static void putSubmit(std::vector<std::uint8_t>& out, std::vector<std::uint8_t>& payload, const ScoreSubmission& s) {
+    payload.clear();
+    payload.push_back(static_cast<std::uint8_t>(FrameKind::Submit));
+    putLE(payload, s.id, 8);
+    putLE(payload, static_cast<std::uint64_t>(s.unixTime), 8);
+    putLE(payload, static_cast<std::uint32_t>(s.score), 4);
+    putString(payload, s.player);
+    putString(payload, s.mode);
+    putFrame(out, payload);
+}
+
+static void putAck(std::vector<std::uint8_t>& out, std::vector<std::uint8_t>& payload, std::uint64_t id) {
+    payload.clear();
+    payload.push_back(static_cast<std::uint8_t>(FrameKind::Ack));
+    putLE(payload, id, 8);
+    putFrame(out, payload);
+}
+
+static void putHeader(std::vector<std::uint8_t>& out) {
+    out.insert(out.end(), std::begin(JOURNAL_MAGIC), std::end(JOURNAL_MAGIC));
+    putLE(out, JOURNAL_VERSION, 4);
+}
+
+// Everything a scan of the file found
+struct JournalScan {
+    std::vector<ScoreSubmission> submits;
+    std::uint64_t acked{ 0 };
+    std::uint64_t maxId{ 0 };
+    std::size_t   goodEnd{ 0 };   // bytes up to the last intact frame
+};
+
+static bool parseSubmit(const std::uint8_t* p, std::size_t n, ScoreSubmission& s) {
+    if (n < 1 + 8 + 8 + 4 + 2) return false;
+    s.id = getLE(p + 1, 8);
+    s.unixTime = static_cast<std::int64_t>(getLE(p + 9, 8));
+    s.score = static_cast<std::int32_t>(static_cast<std::uint32_t>(getLE(p + 17, 4)));
+    std::size_t at = 21;
+    for (std::string* str : { &s.player, &s.mode }) {
+        if (at + 2 > n) return false;
+        const std::size_t len = static_cast<std::size_t>(getLE(p + at, 2));
+        at += 2;
+        if (at + len > n) return false;
+        str->assign(reinterpret_cast<const char*>(p + at), len);
+        at += len;
+    }
+    return at == n;
+}
+
+static JournalScan scanJournal(const std::vector<std::uint8_t>& bytes) {
+    JournalScan scan;
+    scan.goodEnd = HEADER_SIZE;
+    std::size_t at = HEADER_SIZE;
+    while (at + FRAME_HEADER <= bytes.size()) {
+        const std::size_t len = static_cast<std::size_t>(getLE(&bytes[at], 4));
+        const std::uint32_t crc = static_cast<std::uint32_t>(getLE(&bytes[at + 4], 4));
+        if (len == 0 || len > MAX_PAYLOAD || at + FRAME_HEADER + len > bytes.size()) break;   // torn
+        const std::uint8_t* p = &bytes[at + FRAME_HEADER];
+        if (crc32(p, len) != crc) break;                                                      // corrupt
+
+        if (p[0] == static_cast<std::uint8_t>(FrameKind::Submit)) {
+            ScoreSubmission s;
+            if (!parseSubmit(p, len, s)) break;
+            scan.maxId = std::max(scan.maxId, s.id);
+            scan.submits.push_back(std::move(s));
+        }
+        else if (p[0] == static_cast<std::uint8_t>(FrameKind::Ack) && len == 9) {
+            scan.acked = std::max(scan.acked, getLE(p + 1, 8));
+        }
+        else {
+            break;
+        }
+        at += FRAME_HEADER + len;
+        scan.goodEnd = at;
+    }
+    return scan;
+}
+
+// fflush + fsync: returns once the bytes are on the disk, not just in the OS cache
+static bool syncFile(std::FILE* f) {
+    if (std::fflush(f) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(f)) == 0;
+#else
+    return fsync(fileno(f)) == 0;
+#endif
+}
+
+// Append mode, positioned at the end so ftell() reports the file size
+static std::FILE* openAppend(const std::filesystem::path& path) {
+    std::FILE* f = std::fopen(path.string().c_str(), "ab");
+    if (f) std::fseek(f, 0, SEEK_END);
+    return f;
+}
+
+static std::int64_t unixNow() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+// ============================================================================
+
+
+ScoreJournal::ScoreJournal(std::filesystem::path path, Sink sink, JournalOptions options)
+    : m_path(std::move(path)), m_sink(std::move(sink)), m_options(options) {
+}
+
+ScoreJournal::~ScoreJournal() {
+    stop();
+}
+
+std::string ScoreJournal::open() {
+    if (m_open) return {};
+    // Left over from a previous open()/stop() cycle: replay comes from the file
+    m_unacked.clear();
+    m_nextDelivery = {};
+
+    // ---- Scan what a previous process left (if anything) ----
+    std::error_code ec;
+    JournalScan scan;
+    if (std::filesystem::exists(m_path, ec)) {
+        std::ifstream in(m_path, std::ios::binary);
+        if (!in) return "cannot read " + m_path.string();
+        const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), {});
+        in.close();
+
+        const bool headerOk = bytes.size() >= HEADER_SIZE
+            && std::equal(std::begin(JOURNAL_MAGIC), std::end(JOURNAL_MAGIC), bytes.begin())
+            && getLE(&bytes[4], 4) == JOURNAL_VERSION;
+        if (!headerOk) {
+            // Not ours (or crashed before the header hit the disk): keep it for inspection
+            std::filesystem::path aside = m_path;
+            aside += ".bad";
+            std::filesystem::rename(m_path, aside, ec);
+            if (ec) return "unreadable journal " + m_path.string() + " could not be moved aside";
+            AF_LOG_WARN("DB", "score journal %s has a bad header; moved to %s", m_path.string(), aside.string());
+        }
+        else {
+            scan = scanJournal(bytes);
+            if (scan.goodEnd < bytes.size()) {
+                AF_LOG_WARN("DB", "score journal: dropping %zu torn bytes at the end", bytes.size() - scan.goodEnd);
+                std::filesystem::resize_file(m_path, scan.goodEnd, ec);
+                if (ec) return "cannot repair " + m_path.string() + ": " + ec.message();
+            }
+        }
+    }
+
+    if (!reopen()) return "cannot open " + m_path.string() + " for writing";
+
+    // ---- Durable but never acked: replay first ----
+    for (ScoreSubmission& s : scan.submits) {
+        if (s.id > scan.acked) m_unacked.push_back(std::move(s));
+    }
+    std::sort(m_unacked.begin(), m_unacked.end(),
+        [](const ScoreSubmission& a, const ScoreSubmission& b) { return a.id < b.id; });
+    if (!m_unacked.empty()) {
+        AF_LOG_INFO("DB", "score journal: replaying %zu un-acked score(s)", m_unacked.size());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_nextId = std::max(scan.maxId, scan.acked) + 1;
+        m_durableId = scan.maxId;
+        m_ackedId = scan.acked;
+        m_open = true;
+        m_stopping = false;
+    }
+    m_nextDelivery = std::chrono::steady_clock::now();
+    m_thread = std::thread(&ScoreJournal::run, this);
+    return {};
+}
+
+void ScoreJournal::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_open) return;
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    if (m_thread.joinable()) m_thread.join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+    m_open = false;
+}
+
+std::uint64_t ScoreJournal::submit(const std::string& player, int score, const std::string& mode) {
+    ScoreSubmission entry{ 0, player, score, mode, unixNow() };   // built outside the lock
+    std::uint64_t id = 0;
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_open || m_stopping) return 0;
+        id = entry.id = m_nextId++;
+        first = m_incoming.empty();
+        m_incoming.push_back(std::move(entry));
+    }
+    if (first) m_wake.notify_one();   // the rest of a burst rides the same commit
+    return id;
+}
+
+std::uint64_t ScoreJournal::durableId() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_durableId;
+}
+
+std::uint64_t ScoreJournal::ackedId() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_ackedId;
+}
+
+void ScoreJournal::run() {
+    using Clock = std::chrono::steady_clock;
+    std::vector<ScoreSubmission> batch;   // taken from m_incoming, not yet durable
+    Clock::time_point retryCommit{};
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        const auto ready = [this] { return !m_incoming.empty() || m_stopping; };
+        if (!batch.empty())          m_wake.wait_until(lock, retryCommit, ready);
+        else if (!m_unacked.empty()) m_wake.wait_until(lock, m_nextDelivery, ready);
+        else                         m_wake.wait(lock, ready);
+
+        // Group commit: let the rest of a burst arrive, then one fsync for all of it
+        if (!m_incoming.empty() && !m_stopping) {
+            m_wake.wait_for(lock, m_options.commitWindow, [this] { return m_stopping; });
+        }
+        std::move(m_incoming.begin(), m_incoming.end(), std::back_inserter(batch));
+        m_incoming.clear();
+        const bool stopping = m_stopping;
+        lock.unlock();
+
+        if (!batch.empty() && (stopping || Clock::now() >= retryCommit)) {
+            if (commit(batch)) batch.clear();
+            else retryCommit = Clock::now() + m_options.retryInterval;
+        }
+        if (!m_unacked.empty() && (stopping || Clock::now() >= m_nextDelivery)) deliver();
+
+        if (stopping) {
+            if (!batch.empty()) {
+                AF_LOG_ERROR("DB", "score journal: %zu score(s) could not be written and are lost", batch.size());
+            }
+            if (!m_unacked.empty()) {
+                AF_LOG_WARN("DB", "score journal: %zu score(s) kept for the next start", m_unacked.size());
+            }
+            return;
+        }
+        lock.lock();
+    }
+}
+
+bool ScoreJournal::commit(std::vector<ScoreSubmission>& batch) {
+    std::vector<std::uint8_t> bytes, payload;
+    for (const ScoreSubmission& s : batch) putSubmit(bytes, payload, s);
+    if (!appendFrames(bytes, true)) {
+        AF_LOG_WARN("DB", "score journal: write of %zu score(s) failed, retrying", batch.size());
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_durableId = batch.back().id;
+    }
+    std::move(batch.begin(), batch.end(), std::back_inserter(m_unacked));
+    return true;
+}
+
+bool ScoreJournal::deliver() {
+    std::vector<ScoreSubmission> rows;
+    std::vector<std::uint8_t> bytes, payload;
+    while (!m_unacked.empty()) {
+        const std::size_t n = std::min(m_unacked.size(), std::max<std::size_t>(1, m_options.maxBulk));
+        rows.assign(m_unacked.begin(), m_unacked.begin() + static_cast<std::ptrdiff_t>(n));
+        if (auto err = m_sink(rows); !err.empty()) {
+            AF_LOG_WARN("DB", "score journal: %zu score(s) pending, store failed: %s", m_unacked.size(), err);
+            m_nextDelivery = std::chrono::steady_clock::now() + m_options.retryInterval;
+            return false;
+        }
+
+        // One fsync per delivered batch: a lost ack would store these rows twice
+        // after a crash unless the backend dedups by id
+        const std::uint64_t acked = rows.back().id;
+        bytes.clear();
+        putAck(bytes, payload, acked);
+        if (!appendFrames(bytes, true)) {
+            // Stored but not recorded: keep them pending (the retry stores them
+            // again, which the backend dedups by id) rather than claim an ack
+            // the file doesn't have
+            AF_LOG_WARN("DB", "score journal: ack of %zu score(s) could not be written, retrying", n);
+            m_nextDelivery = std::chrono::steady_clock::now() + m_options.retryInterval;
+            return false;
+        }
+        m_unacked.erase(m_unacked.begin(), m_unacked.begin() + static_cast<std::ptrdiff_t>(n));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_ackedId = acked;
+    }
+
+    if (m_file && static_cast<std::uintmax_t>(std::ftell(m_file)) > m_options.compactBytes) compact();
+    return true;
+}
+
+// Everything is acked: rewrite the journal as header + one ack (keeps ids increasing)
+void ScoreJournal::compact() {
+    std::filesystem::path tmp = m_path;
+    tmp += ".tmp";
+
+    std::vector<std::uint8_t> bytes, payload;
+    putHeader(bytes);
+    putAck(bytes, payload, ackedId());
+
+    std::FILE* out = std::fopen(tmp.string().c_str(), "wb");
+    if (!out) return;
+    const bool written = std::fwrite(bytes.data(), 1, bytes.size(), out) == bytes.size() && syncFile(out);
+    std::fclose(out);
+
+    std::error_code ec;
+    if (written) {
+        std::fclose(m_file);
+        std::filesystem::rename(tmp, m_path, ec);   // atomic replace: a crash leaves either file, both valid
+        m_file = openAppend(m_path);
+    }
+    if (!written || ec || !m_file) {
+        AF_LOG_WARN("DB", "score journal: compaction failed, keeping the full file");
+        std::filesystem::remove(tmp, ec);
+        if (!m_file) reopen();
+    }
+}
+
+// Writer file handle after a failed write/rename: opened again on the next
+// attempt, so a transient error (disk full, file briefly locked) doesn't end
+// journaling for the rest of the process. A new or emptied file gets its header.
+bool ScoreJournal::reopen() {
+    if (m_file) return true;
+    m_file = openAppend(m_path);
+    if (!m_file) return false;
+    if (std::ftell(m_file) == 0) {
+        std::vector<std::uint8_t> header;
+        putHeader(header);
+        if (!appendFrames(header, true)) {
+            if (m_file) std::fclose(m_file);
+            m_file = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ScoreJournal::appendFrames(const std::vector<std::uint8_t>& bytes, bool sync) {
+    if (!reopen()) return false;
+    const long before = std::ftell(m_file);
+    const bool ok = std::fwrite(bytes.data(), 1, bytes.size(), m_file) == bytes.size()
+        && (sync ? syncFile(m_file) : std::fflush(m_file) == 0);
+    if (!ok && before >= 0) {
+        // Cut a half-written frame off now, or every later frame would sit behind it
+        std::fclose(m_file);
+        std::error_code ec;
+        std::filesystem::resize_file(m_path, static_cast<std::uintmax_t>(before), ec);
+        m_file = openAppend(m_path);
+    }
+    return ok;
+}
@@ -0,0 +1,129 @@
+// ============================================================================
+//  SerializerBench.cpp — WorldSerializer round-trip check + throughput
+//  Usage: AlienForceSerializerBench [--entities N] [--iters K]
+//  Builds a random world (3/4 enemies, 1/4 shots), checks decode(encode(w))
+//  matches within quantization error, then times encode and decode.
+//  Exit code is non-zero if the round trip fails.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "World.hpp"
+#include "WorldSerializer.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static WorldSnapshot makeWorld(std::size_t entities, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> px(0.f, world::WIDTH - 1.f);
+    std::uniform_real_distribution<float> py(0.f, world::HEIGHT - 1.f);
+    std::uniform_real_distribution<float> vel(-600.f, 600.f);
+    std::uniform_real_distribution<float> speed(40.f, 200.f);
+    std::uniform_real_distribution<float> radius(8.f, 40.f);
+
+    WorldSnapshot w;
+    w.score = 12340;
+    w.lives = 2;
+    w.playerPosition = sf::Vector2f{ px(rng), py(rng) };
+    w.playerRotationDeg = 123.5f;
+
+    const std::size_t enemies = entities * 3 / 4;
+    w.enemies.resize(enemies);
+    for (auto& e : w.enemies) {
+        e = EnemyRecord{ { px(rng), py(rng) }, { vel(rng) / 4.f, vel(rng) / 4.f }, speed(rng), radius(rng), (rng() & 7u) != 0 };
+    }
+    w.shots.resize(entities - enemies);
+    for (auto& s : w.shots) {
+        s = ShotRecord{ { px(rng), py(rng) }, { vel(rng), vel(rng) }, (rng() & 7u) != 0 };
+    }
+    return w;
+}
+
+static bool near(float a, float b, float step) { return std::fabs(a - b) <= step * 0.5f + 1e-3f; }
+
+// Returns number of mismatching fields
+static std::size_t compareWorlds(const WorldSnapshot& a, const WorldSnapshot& b) {
+    using namespace serial;
+    std::size_t bad = 0;
+    bad += a.score != b.score;
+    bad += a.lives != b.lives;
+    bad += !near(a.playerPosition.x, b.playerPosition.x, POS_STEP) + !near(a.playerPosition.y, b.playerPosition.y, POS_STEP);
+    bad += !near(a.playerRotationDeg, b.playerRotationDeg, ROT_STEP);
+    if (a.enemies.size() != b.enemies.size() || a.shots.size() != b.shots.size()) return bad + 1;
+    for (std::size_t i = 0; i < a.enemies.size(); ++i) {
+        const auto& x = a.enemies[i];
+        const auto& y = b.enemies[i];
+        bad += !near(x.position.x, y.position.x, POS_STEP) + !near(x.position.y, y.position.y, POS_STEP);
+        bad += !near(x.velocity.x, y.velocity.x, VEL_STEP) + !near(x.velocity.y, y.velocity.y, VEL_STEP);
+        bad += !near(x.speed, y.speed, SPEED_STEP) + !near(x.radius, y.radius, RADIUS_STEP);
+        bad += x.alive != y.alive;
+    }
+    for (std::size_t i = 0; i < a.shots.size(); ++i) {
+        const auto& x = a.shots[i];
+        const auto& y = b.shots[i];
+        bad += !near(x.position.x, y.position.x, POS_STEP) + !near(x.position.y, y.position.y, POS_STEP);
+        bad += !near(x.velocity.x, y.velocity.x, VEL_STEP) + !near(x.velocity.y, y.velocity.y, VEL_STEP);
+        bad += x.alive != y.alive;
+    }
+    return bad;
+}
+
+int main(int argc, char** argv) {
+    std::size_t entities = 10000;
+    int iters = 500;
+    bench::parseOptions(argc, argv, [&](std::string_view k, const char* v) {
+        if (k == "--entities")   entities = std::max<std::size_t>(1, std::strtoul(v, nullptr, 10));
+        else if (k == "--iters") iters = std::max(1, std::atoi(v));
+        else return false;
+        return true;
+        });
+
+    const WorldSnapshot world = makeWorld(entities, 42);
+    std::vector<std::uint8_t> buf;
+    WorldSnapshot decoded;
+
+    // --- Round trip ---
+    serial::encode(world, buf);
+    if (auto err = serial::decode(buf.data(), buf.size(), decoded); !err.empty()) {
+        std::cout << "[BENCH] round trip FAILED: " << err << "\n";
+        return 1;
+    }
+    if (const std::size_t bad = compareWorlds(world, decoded); bad != 0) {
+        std::cout << "[BENCH] round trip FAILED: " << bad << " fields outside quantization error\n";
+        return 1;
+    }
+    // Truncated input must be rejected, never over-read
+    if (serial::decode(buf.data(), buf.size() / 2, decoded).empty()) {
+        std::cout << "[BENCH] round trip FAILED: truncated buffer accepted\n";
+        return 1;
+    }
+    std::cout << "[BENCH] round trip OK: " << entities << " entities -> " << buf.size() << " bytes ("
+        << static_cast<double>(buf.size()) / entities << " B/entity)\n";
+
+    // --- Encode ---
+    auto t0 = Clock::now();
+    for (int i = 0; i < iters; ++i) serial::encode(world, buf);
+    const double encSec = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    // --- Decode (output vectors reused: no per-entity allocation) ---
+    t0 = Clock::now();
+    for (int i = 0; i < iters; ++i) (void)serial::decode(buf.data(), buf.size(), decoded);
+    const double decSec = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    const double mb = static_cast<double>(buf.size()) * iters / (1024.0 * 1024.0);
+    std::cout << "[BENCH] encode  " << encSec * 1e6 / iters << " us/world  "
+        << encSec * 1e9 / (static_cast<double>(entities) * iters) << " ns/entity  "
+        << mb / encSec << " MB/s\n";
+    std::cout << "[BENCH] decode  " << decSec * 1e6 / iters << " us/world  "
+        << decSec * 1e9 / (static_cast<double>(entities) * iters) << " ns/entity  "
+        << mb / decSec << " MB/s\n";
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include "SimState.hpp"
+#include <algorithm>
+
+RollbackBuffer::RollbackBuffer(std::size_t capacity)
+    : m_slots(std::max<std::size_t>(1, capacity)) {
+}
+
+void RollbackBuffer::push(const SimState& before, const PlayerInput& input) {
+    // Ticks must stay contiguous; anything newer than `before` is stale now
+    if (m_size > 0 && before.tick <= newestTick()) {
+        if (before.tick == 0) m_size = 0;   // restart from tick 0: everything is stale
+        else truncateAfter(before.tick - 1);
+    }
+    if (m_size > 0 && before.tick != newestTick() + 1) m_size = 0;
+
+    Slot& s = m_slots[m_head];
+    s.state = before;   // plain copy: SimState is trivially copyable
+    s.input = input;
+    m_head = (m_head + 1) % m_slots.size();
+    m_size = std::min(m_size + 1, m_slots.size());
+}
+
+std::uint64_t RollbackBuffer::newestTick() const {
+    return m_slots[(m_head + m_slots.size() - 1) % m_slots.size()].state.tick;
+}
+
+std::uint64_t RollbackBuffer::oldestTick() const {
+    return newestTick() - (m_size - 1);
+}
+
+const RollbackBuffer::Slot* RollbackBuffer::find(std::uint64_t tick) const {
+    if (m_size == 0) return nullptr;
+    const std::uint64_t newest = newestTick();
+    if (tick > newest || newest - tick >= m_size) return nullptr;
+    const std::size_t back = static_cast<std::size_t>(newest - tick) + 1;
+    return &m_slots[(m_head + m_slots.size() - back) % m_slots.size()];
+}
+
+const SimState* RollbackBuffer::stateAt(std::uint64_t tick) const {
+    const Slot* s = find(tick);
+    return s ? &s->state : nullptr;
+}
+
+const PlayerInput* RollbackBuffer::inputAt(std::uint64_t tick) const {
+    const Slot* s = find(tick);
+    return s ? &s->input : nullptr;
+}
+
+PlayerInput* RollbackBuffer::inputAt(std::uint64_t tick) {
+    return const_cast<PlayerInput*>(static_cast<const RollbackBuffer*>(this)->inputAt(tick));
+}
+
+void RollbackBuffer::truncateAfter(std::uint64_t tick) {
+    if (m_size == 0) return;
+    const std::uint64_t newest = newestTick();
+    if (tick >= newest) return;
+    const std::uint64_t drop = std::min<std::uint64_t>(newest - tick, m_size);
+    m_size -= static_cast<std::size_t>(drop);
+    m_head = (m_head + m_slots.size() - static_cast<std::size_t>(drop) % m_slots.size()) % m_slots.size();
+}
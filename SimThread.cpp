@@ -0,0 +1,169 @@
+#include "SimThread.hpp"
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+#include "Db.hpp"
+#include "Log.hpp"
+#include "ScoreJournal.hpp"
+#include "WorldSerializer.hpp"
+
+// ============================================================================
+// ==================== Quick save / load (WorldSerializer) ===================
+// ============================================================================
+static constexpr const char* QUICKSAVE_PATH = "quicksave.afws";
+
+static bool quickSave(const GameSession& session) {
+    WorldSnapshot snap;
+    session.captureSnapshot(snap);
+    std::vector<std::uint8_t> bytes;
+    serial::encode(snap, bytes);
+
+    std::ofstream out(QUICKSAVE_PATH, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    AF_LOG_INFO("SAVE", "quick save: %zu bytes, %zu enemies, %zu shots",
+        bytes.size(), snap.enemies.size(), snap.shots.size());
+    return static_cast<bool>(out);
+}
+
+static bool quickLoad(GameSession& session) {
+    std::ifstream in(QUICKSAVE_PATH, std::ios::binary);
+    if (!in) return false;
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), {});
+
+    WorldSnapshot snap;
+    if (auto err = serial::decode(bytes.data(), bytes.size(), snap); !err.empty()) {
+        AF_LOG_WARN("SAVE", "quick load failed: %s", err);
+        return false;
+    }
+    session.applySnapshot(snap);
+    AF_LOG_INFO("SAVE", "quick load: %zu enemies", snap.enemies.size());
+    return true;
+}
+// ============================================================================
+
+
+SimThread::SimThread(sf::Vector2u viewSize, std::shared_ptr<sf::Texture> enemyTex, int hz)
+    : m_session(viewSize, std::move(enemyTex)),
+    m_dt(1.f / static_cast<float>(hz > 0 ? hz : 120)) {
+    publish();   // render thread has a valid Menu frame before the first tick
+}
+
+SimThread::~SimThread() {
+    stop();
+}
+
+void SimThread::start() {
+    if (m_running.exchange(true)) return;
+    m_thread = std::thread(&SimThread::run, this);
+}
+
+void SimThread::stop() {
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) m_thread.join();
+}
+
+void SimThread::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_dt));
+    auto next = Clock::now();
+
+    while (m_running.load(std::memory_order_acquire)) {
+        SimCommand cmd;
+        while (m_commands.pop(cmd)) apply(cmd);
+
+        tick();
+        publish();
+
+        // Fixed rate; if we fell far behind (debugger, sleep) don't spiral, resync
+        next += step;
+        const auto now = Clock::now();
+        if (now - next > step * 8) next = now;
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void SimThread::resetRun() {
+    m_session.reset();
+    m_savedThisRun = false; // allow saving at next game over
+}
+
+void SimThread::apply(const SimCommand& cmd) {
+    switch (cmd.type) {
+    case SimCommand::Type::Input:
+        m_input = cmd.input;
+        m_session.setViewSize(cmd.viewSize);
+        break;
+    case SimCommand::Type::Start:
+        if (m_state != GameState::Arena) {
+            resetRun();
+            m_state = GameState::Arena;
+            m_paused = false;
+        }
+        break;
+    case SimCommand::Type::TogglePause:
+        if (m_state == GameState::Arena) m_paused = !m_paused;
+        break;
+    case SimCommand::Type::Pause:
+        if (m_state == GameState::Arena) m_paused = true;
+        break;
+    case SimCommand::Type::Reset:
+        if (m_state == GameState::Arena) resetRun();
+        break;
+    case SimCommand::Type::QuickSave:
+        if (m_state == GameState::Arena) quickSave(m_session);
+        break;
+    case SimCommand::Type::QuickLoad:
+        if (m_state == GameState::Arena) quickLoad(m_session);
+        break;
+    }
+}
+
+void SimThread::tick() {
+    if (m_state != GameState::Arena || m_paused) return;
+
+    m_session.step(m_dt, m_input);
+    for (const FxEvent& e : m_session.fxEvents()) {
+        if (!m_fx.push(e)) break;
+    }
+
+    // --- Check game over ---
+    if (m_session.isGameOver()) {
+        m_state = GameState::Results;
+        saveScore();
+    }
+}
+
+void SimThread::saveScore() {
+    // DB: save score exactly once per run
+    if (m_savedThisRun) return;
+
+    // Journal: durable on disk within a few ms; it retries / replays into the DB itself
+    if (m_journal) {
+        if (const std::uint64_t id = m_journal->submit("TestPilot", m_session.score(), "demo"); id != 0) {
+            AF_LOG_INFO("DB", "score queued (journal #%llu).", static_cast<unsigned long long>(id));
+            m_savedThisRun = true;
+            return;
+        }
+        AF_LOG_WARN("DB", "score journal closed; saving directly");
+    }
+
+    // Direct (no journal): a failed save is not marked as saved
+    if (auto err = db::upsert_player_and_add_score("TestPilot", m_session.score(), "demo"); !err.empty()) {
+        AF_LOG_WARN("DB", "save failed: %s", err);
+        return;
+    }
+    AF_LOG_INFO("DB", "score saved.");
+    m_savedThisRun = true;
+}
+
+void SimThread::publish() {
+    RenderFrame& f = m_frames.writeBuffer();
+    m_session.snapshot(f.sim);
+    f.chunks = m_session.chunkStats();
+    f.state = m_state;
+    f.paused = m_paused;
+    f.serial = ++m_serial;
+    m_frames.publish();
+}
@@ -0,0 +1,53 @@
+#include "SpriteBatch.hpp"
+#include <cmath>
+
+void SpriteBatch::add(const AtlasRegion& region, sf::Vector2f center, sf::Vector2f size,
+    sf::Angle rotation, sf::Color color) {
+    const float rad = rotation.asRadians();
+    const float c = std::cos(rad);
+    const float s = std::sin(rad);
+    const sf::Vector2f hx{ c * size.x * 0.5f, s * size.x * 0.5f };    // rotated half extents
+    const sf::Vector2f hy{ -s * size.y * 0.5f, c * size.y * 0.5f };
+
+    const sf::Vector2f tl = center - hx - hy;
+    const sf::Vector2f tr = center + hx - hy;
+    const sf::Vector2f br = center + hx + hy;
+    const sf::Vector2f bl = center - hx + hy;
+
+    const float u0 = static_cast<float>(region.rect.position.x);
+    const float v0 = static_cast<float>(region.rect.position.y);
+    const float u1 = u0 + static_cast<float>(region.rect.size.x);
+    const float v1 = v0 + static_cast<float>(region.rect.size.y);
+
+    m_vertices.append(sf::Vertex{ tl, color, { u0, v0 } });
+    m_vertices.append(sf::Vertex{ tr, color, { u1, v0 } });
+    m_vertices.append(sf::Vertex{ br, color, { u1, v1 } });
+    m_vertices.append(sf::Vertex{ tl, color, { u0, v0 } });
+    m_vertices.append(sf::Vertex{ br, color, { u1, v1 } });
+    m_vertices.append(sf::Vertex{ bl, color, { u0, v1 } });
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, const sf::Texture& page) const {
+    if (m_vertices.getVertexCount() == 0) return;
+    target.draw(m_vertices, sf::RenderStates(&page));
+}
+
+std::string GameSprites::resolve(const Atlas& atlas) {
+    const AtlasRegion* w = atlas.find("white");
+    const AtlasRegion* d = atlas.find("disc");
+    if (!w || !d) return "atlas is missing the built-in 'white'/'disc' regions";
+
+    const AtlasRegion* e = atlas.find("enemy");
+    if (!e) e = atlas.find("textures/enemy");
+
+    if (d->page != w->page || (e && e->page != w->page)) {
+        return "gameplay regions are spread over several pages (raise the packer's --page-size)";
+    }
+
+    page = &atlas.page(w->page);
+    white = *w;
+    disc = *d;
+    hasEnemy = e != nullptr;
+    if (e) enemy = *e;
+    return {};
+}
@@ -0,0 +1,104 @@
+#include "World.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+sf::Vector2f world::clampToWorld(sf::Vector2f p) {
+    return sf::Vector2f{ std::clamp(p.x, 0.f, WIDTH), std::clamp(p.y, 0.f, HEIGHT) };
+}
+
+ChunkCoord chunkOf(sf::Vector2f p) {
+    return ChunkCoord{
+        static_cast<int>(std::floor(p.x / world::CHUNK_SIZE)),
+        static_cast<int>(std::floor(p.y / world::CHUNK_SIZE))
+    };
+}
+
+sf::FloatRect activeRegion(ChunkCoord center) {
+    const float r = static_cast<float>(world::ACTIVE_RADIUS);
+    const sf::Vector2f origin{
+        (static_cast<float>(center.x) - r) * world::CHUNK_SIZE,
+        (static_cast<float>(center.y) - r) * world::CHUNK_SIZE
+    };
+    const float side = (2.f * r + 1.f) * world::CHUNK_SIZE;
+    return sf::FloatRect{ origin, sf::Vector2f{ side, side } };
+}
+
+ChunkActivity activityAt(ChunkCoord c, ChunkCoord center) {
+    const int d = std::max(std::abs(c.x - center.x), std::abs(c.y - center.y));   // Chebyshev
+    if (d <= world::ACTIVE_RADIUS) return ChunkActivity::Active;
+    if (d <= world::COARSE_RADIUS) return ChunkActivity::Coarse;
+    return ChunkActivity::Sleeping;
+}
+
+void ChunkMap::beginTick(ChunkCoord playerChunk, std::uint64_t tick) {
+    m_center = playerChunk;
+    m_tick = tick;
+    m_stats = ChunkStats{};
+    m_stats.occupied = m_stats.sleeping = m_sleepingChunks;
+    m_stats.sleepingEntities = m_sleepingEntities;
+    if (++m_stamp == 0) {   // wrapped: stale stamps could match again
+        m_seen.fill(0);
+        m_stamp = 1;
+    }
+}
+
+void ChunkMap::setSleepers(std::size_t chunks, std::size_t entities) {
+    m_stats.occupied = m_stats.occupied - m_sleepingChunks + chunks;
+    m_stats.sleeping = m_stats.sleeping - m_sleepingChunks + chunks;
+    m_stats.sleepingEntities = m_stats.sleepingEntities - m_sleepingEntities + entities;
+    m_sleepingChunks = chunks;
+    m_sleepingEntities = entities;
+}
+
+ChunkTick ChunkMap::touch(sf::Vector2f p) {
+    const ChunkCoord c = chunkOf(p);
+    const int wx = c.x - m_center.x + world::COARSE_RADIUS;
+    const int wy = c.y - m_center.y + world::COARSE_RADIUS;
+    if (wx < 0 || wy < 0 || wx >= WINDOW || wy >= WINDOW) {
+        // Drifted out of the awake window since the last re-sort
+        ++m_stats.sleepingEntities;
+        return ChunkTick{ ChunkActivity::Sleeping, 0 };
+    }
+
+    ChunkTick t;
+    t.activity = activityAt(c, m_center);   // Active or Coarse inside the window
+    if (std::uint32_t& seen = m_seen[static_cast<std::size_t>(wy * WINDOW + wx)]; seen != m_stamp) {
+        seen = m_stamp;
+        ++m_stats.occupied;
+        if (t.activity == ChunkActivity::Active) ++m_stats.active;
+        else ++m_stats.coarse;
+    }
+
+    if (t.activity == ChunkActivity::Active) {
+        t.dtScale = 1;
+    }
+    else {
+        // Stagger coarse chunks across ticks so they don't all land on the same one
+        const std::uint64_t phase = static_cast<std::uint64_t>(c.x * 7 + c.y * 13) & 0xffu;
+        t.dtScale = ((m_tick + phase) % world::COARSE_TICK_INTERVAL == 0) ? world::COARSE_TICK_INTERVAL : 0;
+    }
+
+    if (t.dtScale > 0) ++m_stats.simulatedEntities;
+    return t;
+}
+
+void drawChunkGrid(sf::RenderTarget& target, const sf::View& view) {
+    const sf::Vector2f c = view.getCenter();
+    const sf::Vector2f h = view.getSize() / 2.f;
+    const float left = std::max(0.f, c.x - h.x), right = std::min(world::WIDTH, c.x + h.x);
+    const float top = std::max(0.f, c.y - h.y), bottom = std::min(world::HEIGHT, c.y + h.y);
+    if (left >= right || top >= bottom) return;
+
+    const sf::Color line(255, 255, 255, 28);
+    sf::VertexArray grid(sf::PrimitiveType::Lines);
+    for (float x = std::ceil(left / world::CHUNK_SIZE) * world::CHUNK_SIZE; x <= right; x += world::CHUNK_SIZE) {
+        grid.append(sf::Vertex{ sf::Vector2f{ x, top }, line });
+        grid.append(sf::Vertex{ sf::Vector2f{ x, bottom }, line });
+    }
+    for (float y = std::ceil(top / world::CHUNK_SIZE) * world::CHUNK_SIZE; y <= bottom; y += world::CHUNK_SIZE) {
+        grid.append(sf::Vertex{ sf::Vector2f{ left, y }, line });
+        grid.append(sf::Vertex{ sf::Vector2f{ right, y }, line });
+    }
+    target.draw(grid);
+}
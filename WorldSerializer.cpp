@@ -0,0 +1,218 @@
+#include "WorldSerializer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+    constexpr std::uint8_t MAGIC[4] = { 'A', 'F', 'W', 'S' };
+    constexpr std::size_t  HEADER_BYTES = 6;            // magic + version + flags
+    constexpr std::size_t  MAX_VARINT_BYTES = 10;
+
+    constexpr unsigned PLAYER_BITS = 16 + 16 + 16;
+    constexpr unsigned ENEMY_BITS = 16 + 16 + 16 + 16 + 12 + 8 + 1;
+    constexpr unsigned SHOT_BITS = 16 + 16 + 16 + 16 + 1;
+
+    // ------------------------------------------------------------------ quantize
+    // Clamp in float, then truncate (+0.5 rounds for the unsigned case): avoids lround in the hot loop
+    inline std::uint32_t quantU(float v, float step, std::uint32_t maxQ) {
+        const float q = std::clamp(v / step + 0.5f, 0.f, static_cast<float>(maxQ));
+        return static_cast<std::uint32_t>(q);
+    }
+    inline std::uint32_t quantS16(float v, float step) {
+        const float q = std::clamp(std::nearbyint(v / step), -32768.f, 32767.f);
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(q)) & 0xFFFFu;
+    }
+    inline float dequantS16(std::uint32_t q, float step) {
+        return static_cast<float>(static_cast<std::int16_t>(static_cast<std::uint16_t>(q))) * step;
+    }
+
+    // ------------------------------------------------------------------ varints
+    inline std::uint8_t* putVarint(std::uint8_t* p, std::uint64_t v) {
+        while (v >= 0x80) { *p++ = static_cast<std::uint8_t>(v | 0x80); v >>= 7; }
+        *p++ = static_cast<std::uint8_t>(v);
+        return p;
+    }
+    inline bool getVarint(const std::uint8_t*& p, const std::uint8_t* end, std::uint64_t& v) {
+        v = 0;
+        for (unsigned shift = 0; shift < 64 && p < end; shift += 7) {
+            const std::uint8_t b = *p++;
+            v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+    inline std::uint64_t zigzag(std::int64_t v) { return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63); }
+    inline std::int64_t unzigzag(std::uint64_t v) { return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1); }
+
+    // ------------------------------------------------------------------ bits
+    // 64-bit accumulator, flushed 32 bits at a time (out must have room)
+    class BitWriter {
+    public:
+        explicit BitWriter(std::uint8_t* out) : m_out(out) {}
+
+        void put(std::uint32_t value, unsigned bits) {
+            m_acc |= static_cast<std::uint64_t>(value) << m_bits;
+            m_bits += bits;
+            if (m_bits >= 32) {
+                const std::uint32_t word = static_cast<std::uint32_t>(m_acc);
+                m_out[0] = static_cast<std::uint8_t>(word);
+                m_out[1] = static_cast<std::uint8_t>(word >> 8);
+                m_out[2] = static_cast<std::uint8_t>(word >> 16);
+                m_out[3] = static_cast<std::uint8_t>(word >> 24);
+                m_out += 4;
+                m_acc >>= 32;
+                m_bits -= 32;
+            }
+        }
+        // Flush the tail (zero-padded) and return one past the last byte
+        std::uint8_t* finish() {
+            while (m_bits > 0) {
+                *m_out++ = static_cast<std::uint8_t>(m_acc);
+                m_acc >>= 8;
+                m_bits = m_bits > 8 ? m_bits - 8 : 0;
+            }
+            return m_out;
+        }
+
+    private:
+        std::uint8_t* m_out;
+        std::uint64_t m_acc{ 0 };
+        unsigned      m_bits{ 0 };
+    };
+
+    // Caller checks up front that [p, end) holds every bit it will read
+    class BitReader {
+    public:
+        BitReader(const std::uint8_t* p, const std::uint8_t* end) : m_p(p), m_end(end) {}
+
+        std::uint32_t get(unsigned bits) {
+            if (m_bits < bits) refill();
+            const std::uint32_t v = static_cast<std::uint32_t>(m_acc & ((1ull << bits) - 1));
+            m_acc >>= bits;
+            m_bits -= bits;
+            return v;
+        }
+
+    private:
+        void refill() {
+            while (m_bits <= 56 && m_p < m_end) {
+                m_acc |= static_cast<std::uint64_t>(*m_p++) << m_bits;
+                m_bits += 8;
+            }
+        }
+
+        const std::uint8_t* m_p;
+        const std::uint8_t* m_end;
+        std::uint64_t       m_acc{ 0 };
+        unsigned            m_bits{ 0 };
+    };
+
+    constexpr std::uint32_t POS_MAX = 0xFFFFu;
+    constexpr std::uint32_t SPEED_MAX = 0xFFFu;
+    constexpr std::uint32_t RADIUS_MAX = 0xFFu;
+
+} // namespace
+
+namespace serial {
+
+    std::size_t maxEncodedSize(std::size_t enemyCount, std::size_t shotCount) {
+        const std::size_t bits = PLAYER_BITS + enemyCount * ENEMY_BITS + shotCount * SHOT_BITS;
+        // + 4 slack bytes: BitWriter stores whole 32-bit words
+        return HEADER_BYTES + 4 * MAX_VARINT_BYTES + (bits + 7) / 8 + 4;
+    }
+
+    void encode(const WorldSnapshot& world, std::vector<std::uint8_t>& out) {
+        out.resize(maxEncodedSize(world.enemies.size(), world.shots.size()));
+        std::uint8_t* p = out.data();
+
+        std::memcpy(p, MAGIC, sizeof(MAGIC));
+        p[4] = FORMAT_VERSION;
+        p[5] = 0;
+        p += HEADER_BYTES;
+
+        p = putVarint(p, zigzag(world.score));
+        p = putVarint(p, static_cast<std::uint64_t>(std::max(world.lives, 0)));
+        p = putVarint(p, world.enemies.size());
+        p = putVarint(p, world.shots.size());
+
+        BitWriter bw(p);
+        bw.put(quantU(world.playerPosition.x, POS_STEP, POS_MAX), 16);
+        bw.put(quantU(world.playerPosition.y, POS_STEP, POS_MAX), 16);
+        float rot = std::fmod(world.playerRotationDeg, 360.f);
+        if (rot < 0.f) rot += 360.f;
+        bw.put(static_cast<std::uint32_t>(std::lround(rot / ROT_STEP)) & 0xFFFFu, 16);
+
+        for (const EnemyRecord& e : world.enemies) {
+            bw.put(quantU(e.position.x, POS_STEP, POS_MAX), 16);
+            bw.put(quantU(e.position.y, POS_STEP, POS_MAX), 16);
+            bw.put(quantS16(e.velocity.x, VEL_STEP), 16);
+            bw.put(quantS16(e.velocity.y, VEL_STEP), 16);
+            bw.put(quantU(e.speed, SPEED_STEP, SPEED_MAX), 12);
+            bw.put(quantU(e.radius, RADIUS_STEP, RADIUS_MAX), 8);
+            bw.put(e.alive ? 1u : 0u, 1);
+        }
+        for (const ShotRecord& s : world.shots) {
+            bw.put(quantU(s.position.x, POS_STEP, POS_MAX), 16);
+            bw.put(quantU(s.position.y, POS_STEP, POS_MAX), 16);
+            bw.put(quantS16(s.velocity.x, VEL_STEP), 16);
+            bw.put(quantS16(s.velocity.y, VEL_STEP), 16);
+            bw.put(s.alive ? 1u : 0u, 1);
+        }
+
+        out.resize(static_cast<std::size_t>(bw.finish() - out.data()));
+    }
+
+    std::string decode(const std::uint8_t* data, std::size_t size, WorldSnapshot& out) {
+        if (!data || size < HEADER_BYTES) return "snapshot truncated (header)";
+        if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) return "not a world snapshot (bad magic)";
+        if (data[4] != FORMAT_VERSION) return "unsupported snapshot version " + std::to_string(data[4]);
+
+        const std::uint8_t* p = data + HEADER_BYTES;
+        const std::uint8_t* end = data + size;
+
+        std::uint64_t score = 0, lives = 0, enemyCount = 0, shotCount = 0;
+        if (!getVarint(p, end, score) || !getVarint(p, end, lives) ||
+            !getVarint(p, end, enemyCount) || !getVarint(p, end, shotCount)) {
+            return "snapshot truncated (counts)";
+        }
+
+        // Validate the whole bit stream size once so the loops need no checks
+        const std::uint64_t availBits = static_cast<std::uint64_t>(end - p) * 8;
+        if (enemyCount > availBits / ENEMY_BITS || shotCount > availBits / SHOT_BITS) {
+            return "snapshot truncated (entities)";
+        }
+        const std::uint64_t needBits = PLAYER_BITS + enemyCount * ENEMY_BITS + shotCount * SHOT_BITS;
+        if (needBits > availBits) return "snapshot truncated (entities)";
+
+        out.score = static_cast<int>(unzigzag(score));
+        out.lives = static_cast<int>(lives);
+
+        BitReader br(p, end);
+        out.playerPosition.x = static_cast<float>(br.get(16)) * POS_STEP;
+        out.playerPosition.y = static_cast<float>(br.get(16)) * POS_STEP;
+        out.playerRotationDeg = static_cast<float>(br.get(16)) * ROT_STEP;
+
+        out.enemies.resize(static_cast<std::size_t>(enemyCount));   // keeps capacity across calls
+        for (EnemyRecord& e : out.enemies) {
+            e.position.x = static_cast<float>(br.get(16)) * POS_STEP;
+            e.position.y = static_cast<float>(br.get(16)) * POS_STEP;
+            e.velocity.x = dequantS16(br.get(16), VEL_STEP);
+            e.velocity.y = dequantS16(br.get(16), VEL_STEP);
+            e.speed = static_cast<float>(br.get(12)) * SPEED_STEP;
+            e.radius = static_cast<float>(br.get(8)) * RADIUS_STEP;
+            e.alive = br.get(1) != 0;
+        }
+
+        out.shots.resize(static_cast<std::size_t>(shotCount));
+        for (ShotRecord& s : out.shots) {
+            s.position.x = static_cast<float>(br.get(16)) * POS_STEP;
+            s.position.y = static_cast<float>(br.get(16)) * POS_STEP;
+            s.velocity.x = dequantS16(br.get(16), VEL_STEP);
+            s.velocity.y = dequantS16(br.get(16), VEL_STEP);
+            s.alive = br.get(1) != 0;
+        }
+        return {};
+    }
+
+} // namespace serial